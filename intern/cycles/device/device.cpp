@@ -628,6 +628,16 @@ void GPUDevice::move_textures_to_host(size_t size, bool for_texture)
   load_texture_info();
 }
 
+/**
+ * Allocation implements out-of-core rendering at whole-array granularity: when device memory
+ * runs out, image textures are spilled to pinned host memory first (accessed through mapped
+ * host pointers over the bus), then the global geometry arrays, while #MEM_DEVICE_ONLY
+ * allocations such as the BVH always stay resident and fail hard if they cannot fit. The
+ * trade-off baked in here is that an array is either fully resident or fully host-mapped; there
+ * is no page level residency. Finer paging would mean CUDA managed memory with residency hints
+ * instead of explicit `cuMemAlloc`, which historically benchmarked far slower for coherent
+ * access patterns than this explicit spill order, so scenes that fit must not pay for it.
+ */
 GPUDevice::Mem *GPUDevice::generic_alloc(device_memory &mem, size_t pitch_padding)
 {
   void *device_pointer = 0;
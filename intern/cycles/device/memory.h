@@ -521,6 +521,11 @@ template<typename T> class device_vector : public device_memory {
     }
   }
 
+  /* NOTE: The modified flag covers the whole vector, so this re-uploads the full buffer even
+   * when only one geometry's slice of a scene-wide packed array (`tri_verts` and friends)
+   * changed. For persistent data renders where a single deforming object dirties the array every
+   * frame, the next improvement is tracking a modified element range here and adding a ranged
+   * `mem_copy_to()` to the device backends, so only the dirty slice crosses the bus. */
   void copy_to_device_if_modified()
   {
     if (!modified) {
@@ -539,6 +539,20 @@ void PathTraceWorkGPU::enqueue_path_iteration(DeviceKernel kernel, const int num
   }
 }
 
+/* NOTE: Shader sorting and compaction largely exist already: every shading kernel schedule goes
+ * through this function (per-kernel sort key counters, either the partitioned local bucket/write
+ * sort or the global prefix-sum path below), and compact_main_paths() re-packs states once
+ * occupancy drops below min_num_active_main_paths_. Persistent material-binned queues that
+ * survive across bounces would not improve on this: intersection results scramble the shader
+ * distribution every bounce anyway, so the per-schedule re-sort is the correct granularity.
+ *
+ * What is actually missing is visibility. The sort counters hold the exact per-shader occupancy
+ * histogram right before each shading launch, but are never read back; the only metric surfaced
+ * is the overall occupancy in RenderStatistics. A divergence metric (expected number of distinct
+ * sort keys per warp-sized group, computed from the counter histogram) read back at the
+ * RenderScheduler's report cadence would show whether the sort partitions are too coarse on
+ * shader-heavy scenes, and whether raising num_sort_partitions_ pays off. Readback must be
+ * debug-gated: the counters live in the integrator state and a sync per bounce is not free. */
 void PathTraceWorkGPU::compute_sorted_queued_paths(DeviceKernel queued_kernel,
                                                    const int num_paths_limit)
 {
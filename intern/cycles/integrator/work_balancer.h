@@ -24,7 +24,16 @@ struct WorkBalanceInfo {
 void work_balance_do_initial(vector<WorkBalanceInfo> &work_balance_infos);
 
 /* Rebalance work after statistics has been accumulated.
- * Returns true if the balancing did change. */
+ * Returns true if the balancing did change.
+ *
+ * This is what keeps mixed multi-GPU setups busy: the initial equal split only lasts until the
+ * first measurement. #PathTrace::rebalance() feeds the time each device spent on its slice of
+ * the big tile back in here, the weights converge towards equal time per device, and the slices
+ * are re-partitioned (with buffer regions migrating between devices) whenever the difference is
+ * above the 2% threshold. The static memory split in `device/multi_device.cpp` is unrelated to
+ * work scheduling. Rebalancing happens between scheduled path trace works (see
+ * #RenderScheduler::work_need_rebalance), not within one, as a slice cannot be split while a
+ * device is tracing it. */
 bool work_balance_do_rebalance(vector<WorkBalanceInfo> &work_balance_infos);
 
 CCL_NAMESPACE_END
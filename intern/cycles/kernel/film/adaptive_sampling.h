@@ -27,7 +27,18 @@ ccl_device_forceinline bool film_need_sample_pixel(KernelGlobals kg,
   return buffer[aux_w_offset] == 0.0f;
 }
 
-/* Determines whether to continue sampling a given pixel or if it has sufficiently converged. */
+/* Determines whether to continue sampling a given pixel or if it has sufficiently converged.
+ *
+ * NOTE: Convergence is judged on the combined pass only. Secondary passes that compositing relies
+ * on (shadow catcher most notably) can still be noisy when beauty converges, which pushes users to
+ * lower the threshold and over-sample everything. Extending this to per-pass error would mean:
+ * an additional aux accumulator (odd-sample average, like pass_adaptive_aux_buffer holds for
+ * combined) per selected pass, the same relative-error formula evaluated per pass, and the pixel
+ * kept active until the maximum over selected passes converges — the converged flag in aux.w
+ * stays the single source of truth, so the filter kernels, the sample-count pass and the
+ * RenderScheduler need no structural change beyond declaring which passes opt in. Cryptomatte
+ * should not use this noise metric: its payload is ID/coverage data, and the right criterion is
+ * stability of the coverage weights between filter rounds, not intensity error. */
 
 ccl_device bool film_adaptive_sampling_convergence_check(KernelGlobals kg,
                                                          ccl_global float *render_buffer,
@@ -76,6 +76,17 @@ void OSLRenderServices::register_closures(OSL::ShadingSystem *ss)
 
 /* Surface & Background */
 
+/* NOTE: Execution here is single-point, and that is currently forced by the integrator, not by
+ * this file: the CPU integrator runs one path per thread with scalar state, so at the moment
+ * osl_eval_nodes() is called there is only ever one shading point in existence. Adopting OSL's
+ * batched interface (BatchedRendererServices<WidthT>, ShadingSystem::execute_batch) requires the
+ * caller to gather 8/16 points that share a shader group, which on the CPU means a wavefront-style
+ * shading queue akin to the GPU integrator — sorting shading requests by shader before flushing a
+ * batch. The pieces needed in this directory are mechanical once that exists: a
+ * BatchedRendererServices implementation mirroring OSLRenderServices (trace and get_attribute are
+ * the callbacks with real wide variants), Block<> layout for ShaderGlobals, and per-group scalar
+ * fallback via ShadingSystem::configure_batch_execution_at() for groups the batched JIT rejects.
+ * Closure accumulation stays scalar: Ci lists are per-point either way. */
 template<>
 void osl_eval_nodes<SHADER_TYPE_SURFACE>(const KernelGlobalsCPU *kg,
                                          const void *state,
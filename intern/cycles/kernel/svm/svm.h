@@ -23,6 +23,15 @@
  * closure type, associated label, data and weight. Sampling from multiple
  * closures is supported through the mix closure node, the logic for that is
  * mostly taken care of in the SVM compiler.
+ *
+ * Evaluation is scalar: one shading point walks the node list at a time. On the CPU, SIMD units
+ * are used within a node through the vectorized float3/float4 types, not across shading points.
+ * Shading a packet of points per SVM instruction (SoA stacks, masked execution for nodes whose
+ * control flow diverges, gather based attribute and texture reads) is how the wavefront GPU path
+ * effectively behaves across threads, but on the CPU it would require an SoA variant of the
+ * node implementations and of ShaderData. Such a mode only helps while enough coherent points
+ * share one shader, something the CPU integrator's per-tile ray streams do not currently sort
+ * for, so the sorting would have to come first.
  */
 
 #include "kernel/svm/types.h"
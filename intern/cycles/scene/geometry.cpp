@@ -767,6 +767,15 @@ void GeometryManager::device_update(Device *device,
   }
 
   /* Tessellate meshes that are using subdivision */
+  /* NOTE: Tessellation results only live as long as the Mesh node. Within a session
+   * #Mesh::need_tesselation() keeps unmodified meshes from being re-diced, but every new viewport
+   * render session starts from a fresh Scene and pays the full dicing cost again even when nothing
+   * changed. Caching diced geometry across sessions would need the result to be stored outside the
+   * Scene (similar to how the OpenSubdiv evaluators cache topology refiners), keyed by base mesh
+   * topology, subdivision settings and a quantized dicing camera cell so small camera moves reuse
+   * the cache. A finer-grained win within a session would be re-splitting only the patches whose
+   * screen-space dicing rate changed instead of the whole mesh; #DiagSplit currently always starts
+   * from the base mesh. */
   if (total_tess_needed) {
     scoped_callback_timer timer([scene](double time) {
       if (scene->update_stats) {
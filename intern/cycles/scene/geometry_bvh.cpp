@@ -126,6 +126,11 @@ void GeometryManager::device_update_bvh(Device *device,
 
   VLOG_INFO << "Using " << bvh_layout_name(bparams.bvh_layout) << " layout.";
 
+  /* Deforming geometry does not rebuild here: when its topology is unchanged, the per-geometry
+   * BVH above is refitted instead (see #Geometry::compute_bvh and #Geometry::need_update_rebuild).
+   * This flag only concerns the top level BVH over the objects. Embree is excluded because
+   * #BVHEmbree::refit only refreshes vertex buffers; the top level scene would additionally need
+   * its instance transforms updated and objects attached/detached to be reusable. */
   const bool can_refit = scene->bvh != nullptr &&
                          (bparams.bvh_layout == BVHLayout::BVH_LAYOUT_OPTIX ||
                           bparams.bvh_layout == BVHLayout::BVH_LAYOUT_METAL);
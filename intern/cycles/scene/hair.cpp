@@ -484,6 +484,18 @@ void Hair::apply_transform(const Transform &tfm, const bool apply_to_motion)
   }
 }
 
+/* NOTE: Curve keys are stored uncompressed: one float4 per key here, plus one float4 per key per
+ * motion step in the motion attribute, which dominates device memory on dense grooms. A workable
+ * compression scheme: keep the rest positions as float4 (intersection reads them on every
+ * traversal step and must stay cheap), but store the motion steps as 16-bit offsets relative to
+ * the rest key, quantized against a per-curve displacement bound kept in KernelCurve. Motion keys
+ * are only touched inside motion_curve_keys*() interpolation in kernel/geom/curve.h and
+ * motion_curve.h, so decompression has a single choke point and the attribute lookup can return
+ * reconstructed float4s without the intersectors noticing. The BVH side needs nothing new for
+ * this: curve motion bounds are already computed from interpolated key positions, and quantized
+ * steps only need the bound padded by the quantization error (half a step of the per-curve
+ * scale). BVH refit across motion steps is a non-issue — motion blur builds one BVH whose leaves
+ * carry per-step bounds; there is no per-step rebuild to avoid. */
 void Hair::pack_curves(Scene *scene,
                        float4 *curve_key_co,
                        KernelCurve *curves,
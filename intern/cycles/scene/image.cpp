@@ -484,6 +484,12 @@ size_t ImageManager::add_image_slot(ImageLoader *loader,
   img->params = params;
   img->loader = loader;
   img->need_metadata = true;
+  /* When OSL shading is used on the CPU, file based images are not loaded into device memory at
+   * all: lookups go through the OIIO TextureSystem, which streams mip-mapped tiles on demand
+   * within a fixed cache budget. SVM (and with it every GPU device) instead uploads each image
+   * in full. Extending tile streaming there means a device resident tile cache plus an
+   * indirection in the kernel texture fetch with a miss feedback buffer, and `.tx` generation
+   * for non-tiled sources -- the cache only pays off when files can be read tile-wise. */
   img->need_load = !(osl_texture_system && !img->loader->osl_filepath().empty());
   img->builtin = builtin;
   img->users = 1;
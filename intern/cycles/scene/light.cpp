@@ -803,6 +803,16 @@ void LightManager::device_update_tree(Device *,
   /* Update light tree. */
   progress.set_status("Updating Lights", "Computing tree");
 
+  /* NOTE: The tree is rebuilt from scratch on any light change, including edits that do not alter
+   * the topology of a good tree: changing one light's strength only needs the measured energy
+   * re-propagated from its emitter up to the root, and moving a single light only needs a refit of
+   * the bounding cones/boxes along its path (the BVH equivalent of a refit). Supporting that
+   * requires keeping the built #LightTree (and the emitter-to-node back links) alive on the
+   * manager between updates instead of on the stack here, plus patching the flattened
+   * `light_tree_nodes` array in place rather than re-flattening. Tree quality degrades under
+   * repeated refits, so a full rebuild should still be triggered on large moves or
+   * emitter count changes. */
+
   /* TODO: For now, we'll start with a smaller number of max lights in a node.
    * More benchmarking is needed to determine what number works best. */
   LightTree light_tree(scene, dscene, progress, 8);
@@ -137,7 +137,17 @@ static void create_quad(int3 corners[8],
  * sampling.
  * - Quads are created on the boundary between active and inactive leaf nodes of the temporary
  * grid.
- */
+ *
+ * NOTE: The merged MaskGrid built here is exactly the joint occupancy of all grids on the object
+ * (density, temperature, color, ...), but it is only used to mesh the outer boundary and is then
+ * discarded. Interior empty space survives: ratio tracking in the kernel steps through inactive
+ * regions inside the bounds mesh, sampling every attribute just to read zeros. The natural
+ * extension is to keep this topology: mip the MaskGrid into a small multi-resolution occupancy
+ * bitfield (leaf granularity at the finest level), upload it as a per-geometry side table, and
+ * have the volume read function consult it once per step to skip regions where all attributes
+ * are inactive — one lookup replacing N NanoVDB tree descents, and coherent since every channel
+ * shares the same answer. The max-density majorant per occupancy cell falls out of the same bake
+ * and would tighten ratio tracking beyond plain binary skipping. */
 class VolumeMeshBuilder {
  public:
 #ifdef WITH_OPENVDB
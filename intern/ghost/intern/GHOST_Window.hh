@@ -190,6 +190,17 @@ class GHOST_Window : public GHOST_IWindow {
    * Sets the swap interval for #swapBuffers.
    * \param interval: The swap interval to use.
    * \return A boolean success indicator.
+   *
+   * \note Swapping is currently fire-and-forget: nothing reports when a frame actually reached
+   * the display, so the window manager cannot tell a comfortably-hit vblank from a barely-missed
+   * one and heavy scenes judder unpredictably on high refresh displays. Presentation feedback
+   * would follow the pattern of these swap-interval methods: a `getLastPresentationTime()`
+   * virtual with a per-platform override where the backend has a real source (DXGI frame
+   * statistics, the Wayland `presentation-time` protocol, `GLX_OML_sync_control`) and
+   * #GHOST_kFailure where it does not, exposed through the C API so `wm_draw_update` can skip
+   * optional overlay passes while measured present times trail the refresh deadline. Platforms
+   * without feedback must degrade to today's behavior, so the consumer has to treat the data as
+   * advisory, never as a frame clock.
    */
   GHOST_TSuccess setSwapInterval(int interval) override;
 
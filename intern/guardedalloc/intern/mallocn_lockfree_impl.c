@@ -246,6 +246,24 @@ void *MEM_lockfree_calloc_arrayN(size_t len, size_t size, const char *str)
   return MEM_lockfree_callocN(total_size, str);
 }
 
+/* NOTE: Statistics are no longer the contention point here: counters are sharded per thread in
+ * memory_usage.cc and only folded on query. What multi-threaded evaluation still contends on is
+ * the system allocator itself, since every call lands in malloc/free directly. Two additions
+ * have been designed for this file:
+ *
+ * - Per-thread magazine caches for the small size classes that dominate evaluation traces
+ *   (<= 256 bytes): a handful of fixed-size free lists per thread, refilled from and spilled to
+ *   a global depot in batches. The MemHead prefix already stores the (aligned) length, so frees
+ *   can be routed back to the right class without touching shared state. The thread-exit /
+ *   shutdown hand-off should reuse the Local/Global ownership scheme from memory_usage.cc
+ *   rather than inventing a second one.
+ *
+ * - Sampled call-site attribution usable in release builds: every Nth allocation records `str`
+ *   and size into a per-thread table keyed by the string pointer (the name is virtually always
+ *   a literal), queryable at runtime instead of the all-or-nothing MEM_print_memlist() that
+ *   needs the guarded allocator. Sampling keeps the fast path at one counter decrement.
+ *
+ * Neither may change MemHead layout: the guarded impl and aligned frees rely on it. */
 void *MEM_lockfree_mallocN(size_t len, const char *str)
 {
   MemHead *memh;
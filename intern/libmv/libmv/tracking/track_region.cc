@@ -1305,6 +1305,28 @@ void CopyQuad(double* src_x,
 
 }  // namespace
 
+// NOTE: On batching and vectorization. Cross-marker parallelism already
+// exists on the Blender side: BKE_autotrack_context_step() dispatches
+// independent markers over BLI_task_parallel_range, so TrackRegion() only
+// needs to be fast for a single marker. The remaining scalar hot spots are
+// all in this file:
+//
+// - SampleLinear() bilinear taps, both in the Ceres cost functor and in
+//   PearsonProductMomentCorrelationCoefficient(). The PMCC loop iterates the
+//   pattern row-major with a precomputed warp per sample, so the inner loop
+//   over columns can be rewritten to gather 8 bilinear taps at a time
+//   (AVX2 _mm256_i32gather_ps on the four corner rows) and accumulate the
+//   five PMCC sums in vector registers.
+// - The brute-force initial search in BruteTranslationOnlyInitialize(),
+//   which is a dense SAD scan and vectorizes the same way (or can be
+//   replaced by FFT-based NCC, see the comment above it).
+//
+// The Ceres residual path cannot be vectorized the same way: it evaluates on
+// ceres::Jet types for autodiff, so SIMD there means manual derivative
+// propagation and is not worth the divergence from upstream. Any AVX2 kernels
+// must be runtime-dispatched (this library builds for all x86 targets) and
+// kept behind the existing scalar fallbacks so the code stays upstreamable.
+
 template <typename Warp>
 void TemplatedTrackRegion(const FloatImage& image1,
                           const FloatImage& image2,
@@ -314,6 +314,16 @@ bool MANTA::initNoise(FluidModifierData *fmd)
   return runPythonString(pythonCommands);
 }
 
+/* NOTE: `smoke_adaptive_step` implements the existing adaptive domain: a single axis-aligned box
+ * that shrinks/grows around active density, resizing the whole dense grid set. That helps plumes
+ * but not shots where several small active regions sit inside a large mostly-empty domain -- the
+ * box spans them all and the solver still steps every voxel in between. The finer-grained
+ * successor is block-sparse stepping: track an active block set seeded from the flow sources and
+ * regions with non-negligible density/velocity, dilate it by the per-step CFL travel distance,
+ * and restrict advection/pressure work to those blocks while the rest of the domain stays
+ * static. Mantaflow's solver kernels iterate dense `Grid<T>` memory, so this lands in the kernel
+ * loop bounds on the Mantaflow side (a block mask FlagGrid), surfaced here as a domain setting
+ * alongside FLUID_DOMAIN_USE_ADAPTIVE_DOMAIN rather than a change to this script assembly. */
 bool MANTA::initSmoke(FluidModifierData *fmd)
 {
   vector<string> pythonCommands;
@@ -20,6 +20,16 @@ using OpenSubdiv::Osd::CpuVertexBuffer;
 namespace blender {
 namespace opensubdiv {
 
+// NOTE: Osd::CpuEvaluator runs the stencil and patch kernels scalar and single-threaded, which
+// is why render-time CPU limit evaluation does not scale with cores. OpenSubdiv already ships
+// drop-in replacements with the same interface: OsdTbbEvaluator threads the stencil application
+// (requires building the library WITH_TBB and mapping its arena onto our scheduler so it does
+// not oversubscribe against BLI_task), and the batched EvalStencils path vectorizes well once
+// the element stride is a multiple of the SIMD width -- our buffers are float3, so padding the
+// vertex data descriptor to float4 is part of that change. Swapping the evaluator template
+// parameter here is the whole integration; custom AVX2 kernels only become worth it if the
+// padded TBB path still leaves the gap.
+//
 // NOTE: Define as a class instead of typedef to make it possible
 // to have anonymous class in opensubdiv_evaluator_internal.h
 class CpuEvalOutput : public VolatileEvalOutput<CpuVertexBuffer,
@@ -191,6 +191,16 @@ void RB_dworld_set_split_impulse(rbDynamicsWorld *world, int split_impulse)
 
 /* Simulation ----------------------- */
 
+/* NOTE: This steps a plain #btDiscreteDynamicsWorld: constraint solving runs island by island on
+ * one thread, which is why large destruction shots use a single core. Bullet ships the parallel
+ * variant -- #btDiscreteDynamicsWorldMt with a #btConstraintSolverPoolMt dispatches independent
+ * simulation islands across a task scheduler -- and adopting it here is a construction-time
+ * choice in #RB_dworld_new plus a `btITaskScheduler` implementation forwarding to BLI_task so
+ * Bullet shares Blender's thread pool instead of spawning its own. Determinism caveat: island
+ * order affects contact resolution order, so the Mt world must be configured for deterministic
+ * island ordering or cache re-bakes will not reproduce. The other large cost, collision shape
+ * rebuilds on scale change, lives on the Blender side in `rigidbody.cc`
+ * (`rigidbody_validate_sim_shape`) where a content-hash shape cache would slot in. */
 void RB_dworld_step_simulation(rbDynamicsWorld *world,
                                float timeStep,
                                int maxSubSteps,
@@ -351,6 +351,18 @@ def enable(module_name, *, default_set=False, persistent=False, handle_error=Non
     if default_set:
         _addon_ensure(module_name)
 
+    # NOTE: add-ons necessarily import and register one after another on the main thread:
+    # the GIL serializes module-body execution, registration mutates shared RNA state, and
+    # add-ons may import each other, so there is no safe parallelism to exploit here.
+    # Cold-start time is better recovered by shipping pre-compiled `.pyc` files for the bundled
+    # scripts (priming the `__pycache__` at build or install time), which removes the compile
+    # step without touching the import machinery. The timing below exists so slow add-ons can
+    # be identified with `--debug-python` instead of guessing.
+    use_time = _bpy.app.debug_python
+    if use_time:
+        import time
+        t = time.time()
+
     # Split registering up into 3 steps so we can undo
     # if it fails par way through.
 
@@ -417,8 +429,8 @@ def enable(module_name, *, default_set=False, persistent=False, handle_error=Non
     mod.__addon_enabled__ = True
     mod.__addon_persistent__ = persistent
 
-    if _bpy.app.debug_python:
-        print("\taddon_utils.enable", mod.__name__)
+    if use_time:
+        print("\taddon_utils.enable %s time: %.5f" % (mod.__name__, time.time() - t))
 
     return mod
 
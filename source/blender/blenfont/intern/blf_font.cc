@@ -445,6 +445,19 @@ BLI_INLINE GlyphBLF *blf_glyph_from_utf8_and_step(FontBLF *font,
 /** \name Text Drawing: GPU
  * \{ */
 
+/* NOTE: Every draw re-does the per-glyph work even for strings that are identical frame after
+ * frame: UTF-8 decode, glyph hash lookup, kerning and pen advance. Rasterization is already
+ * cached in GlyphCacheBLF, so for UI text this loop is mostly redundant bookkeeping. A shaped-run
+ * cache fits naturally one level up from the glyph cache: key on the string hash (the font, size
+ * and DPI are implied because the run cache would live on the GlyphCacheBLF, which is per-size),
+ * store the resolved (GlyphBLF *, pen_x) sequence, and replay it straight through
+ * blf_glyph_draw() into the existing batch buffer. Storing glyph pointers is safe under that
+ * ownership: runs die with the glyph cache, so no dangling entries survive a cache clear. The
+ * same runs answer blf_font_width() and bounds queries, which the UI calls far more often than
+ * draw. Per-glyph clipping against `font->clip_rec` keeps working since replay still goes
+ * through blf_glyph_draw(),
+ * and the cache needs an LRU cap — editors render many one-off strings (numbers while dragging)
+ * that should not pin memory. */
 static void blf_font_draw_ex(FontBLF *font,
                              GlyphCacheBLF *gc,
                              const char *str,
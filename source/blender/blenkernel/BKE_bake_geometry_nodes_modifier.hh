@@ -4,6 +4,21 @@
 
 #pragma once
 
+/** \file
+ * \ingroup bke
+ *
+ * Caches for the geometry nodes modifier that survive individual depsgraph evaluations. They are
+ * owned by the original modifier and shared with its evaluated copies, so baked or simulated
+ * results do not have to be recomputed when unrelated parts of the node tree change.
+ *
+ * Reuse of results is explicit, per Simulation Output or Bake node, rather than automatic
+ * memoization keyed by input hashes. Node outputs are generally not a pure function of their
+ * socket inputs (nodes can depend on other objects, collections, scene time, the modified object
+ * itself and anonymous attribute lifetimes), so an automatic cache could not be invalidated
+ * reliably and would hold on to arbitrarily large geometry. With explicit bakes the user decides
+ * which expensive results are worth keeping and when they become outdated.
+ */
+
 #include "BLI_sub_frame.hh"
 
 #include "BKE_bake_items.hh"
@@ -11,6 +11,7 @@
 
 #include "BLI_cpp_type.hh"
 #include "BLI_implicit_sharing.h"
+#include "BLI_offset_indices.hh"
 #include "BLI_set.hh"
 #include "BLI_span.hh"
 #include "BLI_string_ref.hh"
@@ -432,6 +433,22 @@ void CustomData_interp(const CustomData *source,
                        const float *sub_weights,
                        int count,
                        int dest_index);
+/**
+ * Interpolate many destination items at once: for every group `i`, the source items
+ * `src_indices[src_groups[i]]` are interpolated into the destination item `dest_indices[i]`.
+ *
+ * Equivalent to calling #CustomData_interp once per group (without sub-weights), but
+ * parallelized over the destination items, with direct accumulation loops for the common
+ * float/float2/float3/color layer types.
+ *
+ * \param weights: Weight for each entry of \a src_indices, or empty to average each group.
+ */
+void CustomData_interp_batch(const CustomData *source,
+                             CustomData *dest,
+                             blender::OffsetIndices<int> src_groups,
+                             blender::Span<int> src_indices,
+                             blender::Span<float> weights,
+                             blender::Span<int> dest_indices);
 /**
  * \note src_blocks_ofs & dst_block_ofs
  * must be pointers to the data, offset by layer->offset already.
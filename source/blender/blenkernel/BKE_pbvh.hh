@@ -43,8 +43,19 @@ enum PBVHNodeFlags {
   PBVH_TexLeaf = 1 << 16,
   /** Used internally by `pbvh_bmesh.cc`. */
   PBVH_TopologyUpdated = 1 << 17,
+
+  /**
+   * Which vertex buffer contents changed since the last draw buffer update. These narrow
+   * #PBVH_UpdateDrawBuffers so only the affected attributes are re-extracted and re-uploaded;
+   * when a node has #PBVH_UpdateDrawBuffers but none of these, everything is re-extracted.
+   * Cleared together with #PBVH_UpdateDrawBuffers.
+   */
+  PBVH_UpdateDrawPositions = 1 << 18,
+  PBVH_UpdateDrawMask = 1 << 19,
+  PBVH_UpdateDrawFaceSets = 1 << 20,
+  PBVH_UpdateDrawAttributes = 1 << 21,
 };
-ENUM_OPERATORS(PBVHNodeFlags, PBVH_TopologyUpdated);
+ENUM_OPERATORS(PBVHNodeFlags, PBVH_UpdateDrawAttributes);
 
 /* A few C++ methods to play nice with sets and maps. */
 #define PBVH_REF_CXX_METHODS(Class) \
@@ -354,6 +354,15 @@ void update_bounds(PBVH &pbvh, int flags);
 void update_mask(PBVH &pbvh);
 void update_visibility(PBVH &pbvh);
 void update_normals(PBVH &pbvh, SubdivCCG *subdiv_ccg);
+/**
+ * Start recomputing the normals of nodes tagged with #PBVH_UpdateNormals in a background task,
+ * so the work overlaps event handling between stroke steps instead of blocking the stroke loop.
+ * Every code path that modifies positions or reads normals must first call
+ * #update_normals_join (#update_normals does so itself).
+ */
+void update_normals_async(PBVH &pbvh, SubdivCCG *subdiv_ccg);
+/** Wait for a normal update started by #update_normals_async, if any is still running. */
+void update_normals_join(PBVH &pbvh);
 }  // namespace blender::bke::pbvh
 
 blender::Bounds<blender::float3> BKE_pbvh_redraw_BB(PBVH *pbvh);
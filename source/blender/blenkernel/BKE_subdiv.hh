@@ -9,6 +9,7 @@
 #pragma once
 
 #include "BLI_compiler_compat.h"
+#include "BLI_implicit_sharing.h"
 #include "BLI_sys_types.h"
 
 struct Mesh;
@@ -145,6 +146,32 @@ struct SubdivDisplacement {
   void *user_data;
 };
 
+/* Maximum number of mesh arrays tracked by #SubdivTopologyIdentity. */
+#define SUBDIV_TOPOLOGY_IDENTITY_MAX_ARRAYS 16
+
+/* Identifies the mesh arrays a topology refiner was built from.
+ *
+ * The arrays the converter reads are pinned by adding a user to their sharing info, so while the
+ * identity holds them they can neither be freed nor recycled. When a later update receives a mesh
+ * whose arrays are the very same shared buffers, the topology is guaranteed to be unchanged and
+ * both converter construction and the element-wise topology comparison can be skipped. This makes
+ * refiner reuse O(1) for deform-only animation, where every evaluated mesh shares the topology
+ * arrays of the original mesh. */
+struct SubdivTopologyIdentity {
+  /* False when not every relevant array could be captured (e.g. more UV layers than the fixed
+   * capacity, or an array without sharing info); reuse then takes the comparison path. */
+  bool is_valid;
+  int verts_num;
+  int edges_num;
+  int faces_num;
+  int corners_num;
+  /* Presence bits for optional layers, so their absence is part of the identity. */
+  int optional_layers_mask;
+  int arrays_num;
+  const void *arrays[SUBDIV_TOPOLOGY_IDENTITY_MAX_ARRAYS];
+  const ImplicitSharingInfoHandle *sharing_infos[SUBDIV_TOPOLOGY_IDENTITY_MAX_ARRAYS];
+};
+
 /* This structure contains everything needed to construct subdivided surface.
  * It does not specify storage, memory layout or anything else.
  * It is possible to create different storage's (like, grid based CPU side
@@ -166,6 +193,10 @@ struct Subdiv {
   /* Statistics for debugging. */
   SubdivStats stats;
 
+  /* Pinned arrays of the mesh the topology refiner was built from, used by
+   * #BKE_subdiv_update_from_mesh to detect unchanged topology without a full comparison. */
+  SubdivTopologyIdentity topology_identity;
+
   /* Cached values, are not supposed to be accessed directly. */
   struct {
     /* Indexed by base face index, element indicates total number of ptex
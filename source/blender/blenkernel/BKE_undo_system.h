@@ -42,6 +42,18 @@ UNDO_REF_ID_TYPE(Text);
 UNDO_REF_ID_TYPE(Image);
 UNDO_REF_ID_TYPE(PaintCurve);
 
+/** How the stack manages the memory of steps that are not close to the active one. */
+typedef enum eUndoMemoryPolicy {
+  /** Keep all steps in memory as written. */
+  UNDO_MEMORY_POLICY_DEFAULT = 0,
+  /**
+   * Compact steps once they are no longer adjacent to the active one, using the undo type's
+   * #UndoType.step_make_cold callback (steps are expanded again transparently when read).
+   * Trades some CPU on each undo push for a much smaller resident undo history.
+   */
+  UNDO_MEMORY_POLICY_COMPRESS_COLD = 1,
+} eUndoMemoryPolicy;
+
 typedef struct UndoStack {
   ListBase steps;
   struct UndoStep *step_active;
@@ -64,6 +76,9 @@ typedef struct UndoStack {
    * within which all but the last undo-step is marked for skipping.
    */
   int group_level;
+
+  /** See #eUndoMemoryPolicy, applied by #BKE_undosys_step_push_with_type. */
+  eUndoMemoryPolicy memory_policy;
 } UndoStack;
 
 typedef struct UndoStep {
@@ -135,6 +150,13 @@ typedef struct UndoType {
                               UndoTypeForEachIDRefFn foreach_ID_ref_fn,
                               void *user_data);
 
+  /**
+   * Optional. Called when \a us stops being adjacent to the active step and the stack's
+   * #eUndoMemoryPolicy asks for cold steps to be compacted. Implementations may compress or
+   * otherwise shrink the step's data; reading the step must transparently restore it.
+   */
+  void (*step_make_cold)(UndoStep *us);
+
   /** Information for the generic undo system to refine handling of this specific undo type. */
   uint flags;
 
@@ -547,6 +547,19 @@ static void set_rest_position(Mesh &mesh)
   }
 }
 
+/* NOTE: Everything in this stack evaluates on the CPU; the only GPU path (subdivision) lives in
+ * the draw code after the stack has finished, so a run of pure deform modifiers still round-trips
+ * positions through main memory every playback frame. A device path for the leading deform
+ * segment has been designed: a `deform_verts_device` entry in #ModifierTypeInfo, taking and
+ * returning a device position buffer, with this loop keeping the buffer resident across
+ * consecutive capable modifiers and reading back only at the first modifier (or physics caller)
+ * that needs a CPU #Mesh. The candidates are exactly the modifiers whose inputs fit in a few
+ * uniform arrays: Armature (bone matrices + weights), Lattice, SimpleDeform, Smooth. Two things
+ * gate it: evaluation here runs threaded without a GPU context, so device dispatch must be
+ * batched and submitted where a context is legal (the draw/extraction side already solves this
+ * for subdiv, see `draw_subdivision.hh` for the pattern); and `mesh_deform` /orco snapshots below
+ * force a readback wherever they are requested, which limits wins to stacks that don't need
+ * them. */
 static void mesh_calc_modifiers(Depsgraph *depsgraph,
                                 const Scene *scene,
                                 Object *ob,
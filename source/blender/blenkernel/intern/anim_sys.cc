@@ -21,7 +21,9 @@
 #include "BLI_math_rotation.h"
 #include "BLI_math_vector.h"
 #include "BLI_string_utils.hh"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #include "BLT_translation.h"
 
@@ -552,6 +554,14 @@ static void animsys_write_orig_anim_rna(PointerRNA *ptr,
   }
 }
 
+/* An F-Curve together with its resolved RNA property and calculated value, used for batched
+ * evaluation of a curve list. */
+struct FCurveEvalEntry {
+  FCurve *fcu;
+  PathResolvedRNA anim_rna;
+  float value;
+};
+
 /**
  * Evaluate all the F-Curves in the given list
  * This performs a set of standard checks. If extra checks are required,
@@ -562,20 +572,48 @@ static void animsys_evaluate_fcurves(PointerRNA *ptr,
                                      const AnimationEvalContext *anim_eval_context,
                                      bool flush_to_original)
 {
-  /* Calculate then execute each curve. */
+  /* Resolve the RNA property of every evaluatable curve up-front, so that the curve evaluation
+   * itself can be batched over multiple threads. RNA resolving and writing access data shared
+   * between the curves (the animated ID), so they stay on the calling thread. */
+  blender::Vector<FCurveEvalEntry> entries;
   LISTBASE_FOREACH (FCurve *, fcu, list) {
-
     if (!is_fcurve_evaluatable(fcu)) {
       continue;
     }
+    FCurveEvalEntry entry;
+    if (!BKE_animsys_rna_path_resolve(ptr, fcu->rna_path, fcu->array_index, &entry.anim_rna)) {
+      continue;
+    }
+    entry.fcu = fcu;
+    entry.value = 0.0f;
+    entries.append(entry);
+  }
 
-    PathResolvedRNA anim_rna;
-    if (BKE_animsys_rna_path_resolve(ptr, fcu->rna_path, fcu->array_index, &anim_rna)) {
-      const float curval = calculate_fcurve(&anim_rna, fcu, anim_eval_context);
-      BKE_animsys_write_to_rna_path(&anim_rna, curval);
-      if (flush_to_original) {
-        animsys_write_orig_anim_rna(ptr, fcu->rna_path, fcu->array_index, curval);
-      }
+  /* Calculate the curves. Evaluating a curve only reads data shared between the curves and only
+   * writes to the curve itself, so the calculation can happen in parallel. The grain size is
+   * high enough for trivial actions to be evaluated without any threading overhead: batching
+   * only pays off for dense actions such as rigs with thousands of channels.
+   *
+   * Driver curves are skipped here: drivers may run Python expressions, which is not safe from
+   * worker threads. They are calculated with the rest of the serial logic below. */
+  blender::threading::parallel_for(
+      entries.index_range(), 256, [&](const blender::IndexRange range) {
+        for (const int64_t i : range) {
+          FCurveEvalEntry &entry = entries[i];
+          if (entry.fcu->driver == nullptr) {
+            entry.value = calculate_fcurve(&entry.anim_rna, entry.fcu, anim_eval_context);
+          }
+        }
+      });
+
+  /* Write the calculated values into RNA. */
+  for (FCurveEvalEntry &entry : entries) {
+    if (entry.fcu->driver != nullptr) {
+      entry.value = calculate_fcurve(&entry.anim_rna, entry.fcu, anim_eval_context);
+    }
+    BKE_animsys_write_to_rna_path(&entry.anim_rna, entry.value);
+    if (flush_to_original) {
+      animsys_write_orig_anim_rna(ptr, entry.fcu->rna_path, entry.fcu->array_index, entry.value);
     }
   }
 }
@@ -263,6 +263,18 @@ struct ArmatureUserdata {
   } bmesh;
 };
 
+/* NOTE: This path is threaded over vertices but scalar within them, and the inner loop chases
+ * pointers: each influence resolves its group index through `pchan_from_defbase` and reads a
+ * scattered #MDeformWeight list, so wide meshes spend more time in lookups than in the actual
+ * matrix math. The faster layout is a compiled skinning cache on the evaluated mesh: influences
+ * re-sorted into (bone, vertex-range) buckets with flat weight/index arrays, rebuilt only when
+ * weights or the group-to-bone mapping change (the deform-group name resolution makes that
+ * mapping object-pair specific, so the cache keys on armature + mesh). With that layout the hot
+ * loop becomes a straight matrix-palette blend over contiguous data, which the compiler
+ * auto-vectorizes, and the dual-quaternion path blends `DualQuat` components in the same bucket
+ * order. The envelope and B-Bone segment features below are per-vertex special cases that stay
+ * on this fallback path -- the cache only covers the pure weighted-matrix/quaternion majority,
+ * which is what hero-character playback consists of. */
 static void armature_vert_task_with_dvert(const ArmatureUserdata *data,
                                           const int i,
                                           const MDeformVert *dvert)
@@ -863,6 +863,41 @@ void BKE_pose_eval_init_ik(Depsgraph *depsgraph, Scene *scene, Object *object)
   BKE_pose_splineik_init_tree(scene, object, ctime);
 }
 
+/* Gather the inputs of the matrix calculation of a constraint-free, non-IK pose channel and
+ * compare them against the cache from the previous evaluation. Returns true when the inputs did
+ * not change, meaning the matrices stored on the channel are still valid; otherwise the cache is
+ * updated and the matrices need to be re-calculated. */
+static bool pose_channel_matrix_inputs_unchanged(Object *object, bPoseChannel *pchan)
+{
+  bPoseChannel_MatrixCache inputs;
+  /* Zero padding and unused fields, the comparison is over the raw bytes. */
+  memset(&inputs, 0, sizeof(inputs));
+  copy_v3_v3(inputs.loc, pchan->loc);
+  copy_v3_v3(inputs.size, pchan->size);
+  copy_v3_v3(inputs.eul, pchan->eul);
+  copy_qt_qt(inputs.quat, pchan->quat);
+  copy_v3_v3(inputs.rot_axis, pchan->rotAxis);
+  inputs.rot_angle = pchan->rotAngle;
+  copy_m4_m4(inputs.arm_mat, pchan->bone->arm_mat);
+  if (pchan->parent != nullptr) {
+    copy_m4_m4(inputs.parent_pose_mat, pchan->parent->pose_mat);
+  }
+  else {
+    unit_m4(inputs.parent_pose_mat);
+    copy_v3_v3(inputs.cyclic_offset, object->pose->cyclic_offset);
+  }
+  inputs.bone_flag = pchan->bone->flag;
+  inputs.rotmode = pchan->rotmode;
+  inputs.is_valid = 1;
+
+  bPoseChannel_MatrixCache *cache = &pchan->runtime.matrix_cache;
+  if (memcmp(cache, &inputs, sizeof(inputs)) == 0) {
+    return true;
+  }
+  *cache = inputs;
+  return false;
+}
+
 void BKE_pose_eval_bone(Depsgraph *depsgraph, Scene *scene, Object *object, int pchan_index)
 {
   const bArmature *armature = (bArmature *)object->data;
@@ -890,9 +925,15 @@ void BKE_pose_eval_bone(Depsgraph *depsgraph, Scene *scene, Object *object, int
       }
       else {
         if ((pchan->flag & POSE_DONE) == 0) {
-          /* TODO(sergey): Use time source node for time. */
-          float ctime = BKE_scene_ctime_get(scene); /* not accurate... */
-          BKE_pose_where_is_bone(depsgraph, scene, object, pchan, ctime, true);
+          /* Skip the matrix calculation when the channel inputs did not change since the
+           * previous evaluation, which is the common case when only a few bones of a heavy rig
+           * are animated. Channels with constraints or IK take the other code paths above and
+           * never consult the cache: their result depends on more than the cached inputs. */
+          if (!pose_channel_matrix_inputs_unchanged(object, pchan)) {
+            /* TODO(sergey): Use time source node for time. */
+            float ctime = BKE_scene_ctime_get(scene); /* not accurate... */
+            BKE_pose_where_is_bone(depsgraph, scene, object, pchan, ctime, true);
+          }
         }
       }
     }
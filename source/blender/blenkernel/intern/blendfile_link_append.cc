@@ -1373,6 +1373,17 @@ void BKE_blendfile_append(BlendfileLinkAppendContext *lapp_context, ReportList *
   blendfile_link_append_proxies_convert(bmain, reports);
 }
 
+/* NOTE: Linking runs entirely on the main thread, so pulling in a heavy asset freezes the UI for
+ * the whole file read, expansion and instantiation. Most of that time is spent in BLO reading
+ * library data, which does not need the caller's #Main until #BLO_library_link_end: the read and
+ * expand phases could run in a `WM_jobs` worker against the library-side temporary main, with
+ * progress per library/item from the loops below, handing back to the main thread only for
+ * `library_link_end`-style merging into G_MAIN, instantiation and depsgraph tagging. The blocker
+ * is not this file but callers and BLO global state: `BLO_library_link_begin/named_part` touch
+ * shared library caches and report lists, and any main-thread edit to the destination Main while
+ * the job runs (user keeps working, which is the point) must be fenced from the merge step --
+ * practically the merge needs to run from the job's end callback with the usual main-thread
+ * locking, like the sequencer prefetch and compositor jobs do. */
 void BKE_blendfile_link(BlendfileLinkAppendContext *lapp_context, ReportList *reports)
 {
   if (lapp_context->num_items == 0) {
@@ -119,7 +119,14 @@ static BVHTree *bvhtree_build_from_cloth(ClothModifierData *clmd, float epsilon)
   return bvhtree;
 }
 
-void bvhtree_update_from_cloth(ClothModifierData *clmd, bool moving, bool self)
+/* Refitted bounds degrade as the cloth deforms away from the state the tree was balanced for.
+ * Below this quality a full rebuild is cheaper than the extra traversal cost. */
+#define CLOTH_BVH_REBUILD_QUALITY 0.5f
+
+static void cloth_bvhtree_update_impl(ClothModifierData *clmd,
+                                      bool moving,
+                                      bool self,
+                                      bool allow_rebuild)
 {
   uint i = 0;
   Cloth *cloth = clmd->clothObject;
@@ -196,6 +203,32 @@ void bvhtree_update_from_cloth(ClothModifierData *clmd, bool moving, bool self)
       BLI_bvhtree_update_tree(bvhtree);
     }
   }
+
+  /* When refitting degraded the tree too much, rebuild the topology from the current state and
+   * refit once more to fill in the new leaf bounds. The rebuilt tree is not checked again, a
+   * freshly balanced tree is as good as it gets for these positions. */
+  if (allow_rebuild && BLI_bvhtree_refit_quality(bvhtree) < CLOTH_BVH_REBUILD_QUALITY) {
+    BVHTree *bvhtree_new = bvhtree_build_from_cloth(clmd, BLI_bvhtree_get_epsilon(bvhtree));
+    if (bvhtree_new) {
+      if (cloth->bvhselftree == cloth->bvhtree) {
+        cloth->bvhtree = bvhtree_new;
+        cloth->bvhselftree = bvhtree_new;
+      }
+      else if (self) {
+        cloth->bvhselftree = bvhtree_new;
+      }
+      else {
+        cloth->bvhtree = bvhtree_new;
+      }
+      BLI_bvhtree_free(bvhtree);
+      cloth_bvhtree_update_impl(clmd, moving, self, false);
+    }
+  }
+}
+
+void bvhtree_update_from_cloth(ClothModifierData *clmd, bool moving, bool self)
+{
+  cloth_bvhtree_update_impl(clmd, moving, self, true);
 }
 
 void cloth_clear_cache(Object *ob, ClothModifierData *clmd, float framenr)
@@ -1551,6 +1551,18 @@ static bool cloth_bvh_self_overlap_cb(void *userdata, int index_a, int index_b,
   return false;
 }
 
+/* NOTE: The broad phase below runs one #BLI_bvhtree_overlap per collider serially on the CPU
+ * (the narrow-phase proximity tests afterwards are already a parallel range). With many colliders
+ * this loop plus the per-collider BVH refits dominate the cloth step. Two escalation levels
+ * apply: first, the per-collider overlap calls are independent and can run as a parallel-for over
+ * colliders. Beyond that, a GPU broad phase would upload cloth and collider BVHs (the flat
+ * `BVHTree` node array maps directly to an SSBO), generate candidate pairs and run the
+ * triangle-triangle proximity tests in compute, reading back only contact pairs for the CPU
+ * response solve in `cloth_collision_response_static`. That path is only correct from contexts
+ * that may use a GPU context (depsgraph evaluation can run during background renders without
+ * one), so it has to be a capability-gated mode with this CPU path remaining the fallback, and
+ * it only pays off when the readback (one fence per substep) is cheaper than the tests --
+ * i.e. large collider counts, not the single-collider case. */
 int cloth_bvh_collision(
     Depsgraph *depsgraph, Object *ob, ClothModifierData *clmd, float step, float dt)
 {
@@ -784,6 +784,18 @@ static void write_sharp_bezier_edges(const CurvesInfo &curves_info,
   });
 }
 
+/* NOTE: The sweep is structured as separate full passes: positions, then each attribute walks
+ * every curve combination again through #foreach_curve_combination. For many small curves
+ * (cables, hair-like greebles) that layout is cache-hostile in two ways: the per-combination
+ * setup cost in the iterator is paid once per attribute rather than once per curve, and each
+ * pass streams the whole output mesh. Fusing everything into one mega-pass is not the repo's
+ * pattern and would lose the typed-span specializations below, but the passes can be blocked:
+ * iterate combinations once per *batch* of curves, and inside a block run positions plus all
+ * attribute interpolations for just that block's slice, keeping the block's verts/edges/faces
+ * resident in cache. That only requires hoisting the attribute lookups (readers, destination
+ * writers, evaluated-buffer sizing) out of the combination loop — the inner copy helpers
+ * already operate on slices and stay unchanged. Worth it only above a curve-count threshold;
+ * single big curves gain nothing from blocking. */
 Mesh *curve_to_mesh_sweep(const CurvesGeometry &main,
                           const CurvesGeometry &profile,
                           const bool fill_caps,
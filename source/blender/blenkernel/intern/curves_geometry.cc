@@ -738,14 +738,18 @@ Span<float3> CurvesGeometry::evaluated_tangents() const
     r_data.resize(this->evaluated_points_num());
     MutableSpan<float3> tangents = r_data;
 
-    threading::parallel_for(this->curves_range(), 128, [&](IndexRange curves_range) {
-      for (const int curve_index : curves_range) {
-        const IndexRange evaluated_points = evaluated_points_by_curve[curve_index];
-        curves::poly::calculate_tangents(evaluated_positions.slice(evaluated_points),
-                                         cyclic[curve_index],
-                                         tangents.slice(evaluated_points));
-      }
-    });
+    threading::parallel_for_weighted(
+        this->curves_range(),
+        4096,
+        [&](const IndexRange curves_range) {
+          for (const int curve_index : curves_range) {
+            const IndexRange evaluated_points = evaluated_points_by_curve[curve_index];
+            curves::poly::calculate_tangents(evaluated_positions.slice(evaluated_points),
+                                             cyclic[curve_index],
+                                             tangents.slice(evaluated_points));
+          }
+        },
+        [&](const int curve_index) { return evaluated_points_by_curve[curve_index].size(); });
 
     /* Correct the first and last tangents of non-cyclic Bezier curves so that they align with
      * the inner handles. This is a separate loop to avoid the cost when Bezier type curves are
@@ -879,59 +883,64 @@ Span<float3> CurvesGeometry::evaluated_normals() const
     r_data.resize(this->evaluated_points_num());
     MutableSpan<float3> evaluated_normals = r_data;
 
-    threading::parallel_for(this->curves_range(), 128, [&](IndexRange curves_range) {
-      /* Reuse a buffer for the evaluated tilts. */
-      Vector<float> evaluated_tilts;
-
-      for (const int curve_index : curves_range) {
-        const IndexRange evaluated_points = evaluated_points_by_curve[curve_index];
-        switch (NormalMode(normal_mode[curve_index])) {
-          case NORMAL_MODE_Z_UP:
-            curves::poly::calculate_normals_z_up(evaluated_tangents.slice(evaluated_points),
-                                                 evaluated_normals.slice(evaluated_points));
-            break;
-          case NORMAL_MODE_MINIMUM_TWIST:
-            curves::poly::calculate_normals_minimum(evaluated_tangents.slice(evaluated_points),
-                                                    cyclic[curve_index],
-                                                    evaluated_normals.slice(evaluated_points));
-            break;
-          case NORMAL_MODE_FREE:
-            if (custom_normal_span.is_empty()) {
-              curves::poly::calculate_normals_z_up(evaluated_tangents.slice(evaluated_points),
-                                                   evaluated_normals.slice(evaluated_points));
+    threading::parallel_for_weighted(
+        this->curves_range(),
+        2048,
+        [&](const IndexRange curves_range) {
+          /* Reuse a buffer for the evaluated tilts. */
+          Vector<float> evaluated_tilts;
+
+          for (const int curve_index : curves_range) {
+            const IndexRange evaluated_points = evaluated_points_by_curve[curve_index];
+            switch (NormalMode(normal_mode[curve_index])) {
+              case NORMAL_MODE_Z_UP:
+                curves::poly::calculate_normals_z_up(evaluated_tangents.slice(evaluated_points),
+                                                     evaluated_normals.slice(evaluated_points));
+                break;
+              case NORMAL_MODE_MINIMUM_TWIST:
+                curves::poly::calculate_normals_minimum(evaluated_tangents.slice(evaluated_points),
+                                                        cyclic[curve_index],
+                                                        evaluated_normals.slice(evaluated_points));
+                break;
+              case NORMAL_MODE_FREE:
+                if (custom_normal_span.is_empty()) {
+                  curves::poly::calculate_normals_z_up(evaluated_tangents.slice(evaluated_points),
+                                                       evaluated_normals.slice(evaluated_points));
+                }
+                else {
+                  const Span<float3> src = custom_normal_span.slice(points_by_curve[curve_index]);
+                  MutableSpan<float3> dst = evaluated_normals.slice(
+                      evaluated_points_by_curve[curve_index]);
+                  evaluate_generic_data_for_curve(eval_data, curve_index, src, dst);
+                  normalize_span(dst);
+                }
+                break;
             }
-            else {
-              const Span<float3> src = custom_normal_span.slice(points_by_curve[curve_index]);
-              MutableSpan<float3> dst = evaluated_normals.slice(
-                  evaluated_points_by_curve[curve_index]);
-              evaluate_generic_data_for_curve(eval_data, curve_index, src, dst);
-              normalize_span(dst);
-            }
-            break;
-        }
 
-        /* If the "tilt" attribute exists, rotate the normals around the tangents by the
-         * evaluated angles. We can avoid copying the tilts to evaluate them for poly curves. */
-        if (use_tilt) {
-          const IndexRange points = points_by_curve[curve_index];
-          if (types[curve_index] == CURVE_TYPE_POLY) {
-            rotate_directions_around_axes(evaluated_normals.slice(evaluated_points),
-                                          evaluated_tangents.slice(evaluated_points),
-                                          tilt_span.slice(points));
-          }
-          else {
-            evaluated_tilts.reinitialize(evaluated_points.size());
-            evaluate_generic_data_for_curve(eval_data,
-                                            curve_index,
-                                            tilt_span.slice(points),
-                                            evaluated_tilts.as_mutable_span());
-            rotate_directions_around_axes(evaluated_normals.slice(evaluated_points),
-                                          evaluated_tangents.slice(evaluated_points),
-                                          evaluated_tilts.as_span());
+            /* If the "tilt" attribute exists, rotate the normals around the tangents by the
+             * evaluated angles. We can avoid copying the tilts to evaluate them for poly curves.
+             */
+            if (use_tilt) {
+              const IndexRange points = points_by_curve[curve_index];
+              if (types[curve_index] == CURVE_TYPE_POLY) {
+                rotate_directions_around_axes(evaluated_normals.slice(evaluated_points),
+                                              evaluated_tangents.slice(evaluated_points),
+                                              tilt_span.slice(points));
+              }
+              else {
+                evaluated_tilts.reinitialize(evaluated_points.size());
+                evaluate_generic_data_for_curve(eval_data,
+                                                curve_index,
+                                                tilt_span.slice(points),
+                                                evaluated_tilts.as_mutable_span());
+                rotate_directions_around_axes(evaluated_normals.slice(evaluated_points),
+                                              evaluated_tangents.slice(evaluated_points),
+                                              evaluated_tilts.as_span());
+              }
+            }
           }
-        }
-      }
-    });
+        },
+        [&](const int curve_index) { return evaluated_points_by_curve[curve_index].size(); });
   });
   return this->runtime->evaluated_normal_cache.data();
 }
@@ -972,14 +981,18 @@ void CurvesGeometry::interpolate_to_evaluated(const GSpan src, GMutableSpan dst)
   };
   const OffsetIndices evaluated_points_by_curve = this->evaluated_points_by_curve();
 
-  threading::parallel_for(this->curves_range(), 512, [&](IndexRange curves_range) {
-    for (const int curve_index : curves_range) {
-      const IndexRange points = points_by_curve[curve_index];
-      const IndexRange evaluated_points = evaluated_points_by_curve[curve_index];
-      evaluate_generic_data_for_curve(
-          eval_data, curve_index, src.slice(points), dst.slice(evaluated_points));
-    }
-  });
+  threading::parallel_for_weighted(
+      this->curves_range(),
+      4096,
+      [&](const IndexRange curves_range) {
+        for (const int curve_index : curves_range) {
+          const IndexRange points = points_by_curve[curve_index];
+          const IndexRange evaluated_points = evaluated_points_by_curve[curve_index];
+          evaluate_generic_data_for_curve(
+              eval_data, curve_index, src.slice(points), dst.slice(evaluated_points));
+        }
+      },
+      [&](const int curve_index) { return evaluated_points_by_curve[curve_index].size(); });
 }
 
 void CurvesGeometry::ensure_evaluated_lengths() const
@@ -996,16 +1009,20 @@ void CurvesGeometry::ensure_evaluated_lengths() const
     const Span<float3> evaluated_positions = this->evaluated_positions();
     const VArray<bool> curves_cyclic = this->cyclic();
 
-    threading::parallel_for(this->curves_range(), 128, [&](IndexRange curves_range) {
-      for (const int curve_index : curves_range) {
-        const bool cyclic = curves_cyclic[curve_index];
-        const IndexRange evaluated_points = evaluated_points_by_curve[curve_index];
-        const IndexRange lengths_range = this->lengths_range_for_curve(curve_index, cyclic);
-        length_parameterize::accumulate_lengths(evaluated_positions.slice(evaluated_points),
-                                                cyclic,
-                                                evaluated_lengths.slice(lengths_range));
-      }
-    });
+    threading::parallel_for_weighted(
+        this->curves_range(),
+        4096,
+        [&](const IndexRange curves_range) {
+          for (const int curve_index : curves_range) {
+            const bool cyclic = curves_cyclic[curve_index];
+            const IndexRange evaluated_points = evaluated_points_by_curve[curve_index];
+            const IndexRange lengths_range = this->lengths_range_for_curve(curve_index, cyclic);
+            length_parameterize::accumulate_lengths(evaluated_positions.slice(evaluated_points),
+                                                    cyclic,
+                                                    evaluated_lengths.slice(lengths_range));
+          }
+        },
+        [&](const int curve_index) { return evaluated_points_by_curve[curve_index].size(); });
   });
 }
 
@@ -6,6 +6,20 @@
  * \ingroup bke
  */
 
+/* NOTE: On the storage layout. Vertex groups are an array-of-lists: every vertex owns a
+ * heap-allocated MDeformWeight array, so a rigged mesh costs one small allocation per vertex and
+ * deform paths chase a pointer per vertex per frame. A packed per-group layout (CSR: for each
+ * group, runs of (vertex index, weight)) is the cache-friendly inverse and what armature deform
+ * actually wants — it iterates "all weights of one group" per bone. The conversion is not
+ * expressible as a quiet internal change though: MDeformVert is DNA, written to files, exposed
+ * through RNA (`vertex.groups`) and edited in place by dozens of tools that insert and remove
+ * weights per vertex. A migration therefore has to run packed storage behind the attribute API
+ * as the source of truth, with MDeformVert materialized lazily at this file's API boundary for
+ * legacy readers and writes invalidating the packed form — and it only pays off once the hot
+ * consumers (armature deform, weight paint brushes) read the packed side natively. Until that
+ * project lands, the allocation storm on load has a cheaper mitigation: dvert weight arrays of a
+ * mesh can be carved from one pooled allocation since they die together with the layer. */
+
 #include <cctype>
 #include <cmath>
 #include <cstddef>
@@ -2044,9 +2044,20 @@ static float fcurve_eval_keyframes_extrapolate(
   return endpoint_bezt->vec[1][1] - (fac * dx);
 }
 
-static float fcurve_eval_keyframes_interpolate(const FCurve *fcu,
-                                               const BezTriple *bezts,
-                                               float evaltime)
+/* Check whether `evaltime` lies strictly inside the keyframe segment which ends at keyframe
+ * `index`, far enough from both keyframes that the binary search with the given threshold is
+ * guaranteed to return the same index with no exact match. */
+static bool fcurve_segment_contains_time(
+    const BezTriple *bezts, const int index, const int totvert, float evaltime, float threshold)
+{
+  if (index < 1 || index >= totvert) {
+    return false;
+  }
+  return evaltime > bezts[index - 1].vec[1][0] + threshold &&
+         evaltime < bezts[index].vec[1][0] - threshold;
+}
+
+static float fcurve_eval_keyframes_interpolate(FCurve *fcu, const BezTriple *bezts, float evaltime)
 {
   const float eps = 1.e-8f;
   uint a;
@@ -2054,9 +2065,7 @@ static float fcurve_eval_keyframes_interpolate(const FCurve *fcu,
   /* Evaluation-time occurs somewhere in the middle of the curve. */
   bool exact = false;
 
-  /* Use binary search to find appropriate keyframes...
-   *
-   * The threshold here has the following constraints:
+  /* The threshold for the keyframe lookups below has the following constraints:
    * - 0.001 is too coarse:
    *   We get artifacts with 2cm driver movements at 1BU = 1m (see #40332).
    *
@@ -2064,7 +2073,31 @@ static float fcurve_eval_keyframes_interpolate(const FCurve *fcu,
    *   Weird errors, like selecting the wrong keyframe range (see #39207), occur.
    *   This lower bound was established in b888a32eee8147b028464336ad2404d8155c64dd.
    */
-  a = BKE_fcurve_bezt_binarysearch_index_ex(bezts, evaltime, fcu->totvert, 0.0001, &exact);
+  const float threshold = 0.0001f;
+
+  /* Check the segment hit by the previous evaluation and its direct neighbors before falling
+   * back to the binary search. Scrubbing, playback and subframe sampling evaluate the curve at
+   * closely spaced times which makes these segments the common case, skipping nearly all of the
+   * per-sample search work on dense curves such as baked mocap with thousands of keys. Only
+   * unambiguous interior hits are taken: times close to a keyframe go through the binary search
+   * and its threshold handling. */
+  const int last_segment = fcu->last_eval_segment;
+  bool found = false;
+  for (int index = last_segment - 1; index <= last_segment + 1; index++) {
+    if (fcurve_segment_contains_time(bezts, index, fcu->totvert, evaltime, threshold)) {
+      a = index;
+      found = true;
+      break;
+    }
+  }
+  if (!found) {
+    /* Use binary search to find appropriate keyframes. */
+    a = BKE_fcurve_bezt_binarysearch_index_ex(bezts, evaltime, fcu->totvert, threshold, &exact);
+  }
+  /* NOTE: this write is not thread safe, but the worst outcome of a race is a stale hint which
+   * is validated before use anyway. */
+  fcu->last_eval_segment = a;
+
   const BezTriple *bezt = bezts + a;
 
   if (exact) {
@@ -150,6 +150,17 @@ bool driver_get_target_property(const DriverTargetContext *driver_target_context
  * Helper function to obtain a value using RNA from the specified source
  * (for evaluating drivers).
  */
+/* NOTE: The string cost in driver-heavy rigs is concentrated here: every variable of every driver
+ * re-parses `dtar->rna_path` through RNA_path_resolve_property_full() on every evaluation, which
+ * tokenizes the path and does a hashed property lookup per segment. A global interning table for
+ * path strings would not remove that — the expense is resolution, not comparison. The effective
+ * cache is the resolved endpoint: (PointerRNA, PropertyRNA *, index) is stable as long as the
+ * target ID's evaluated copy is the same, so the resolution result can live on the DriverTarget
+ * runtime keyed by the evaluated ID pointer and the depsgraph's update count, exactly like the
+ * existing `dtar->id` dependency that the depsgraph already tracks for relations. Invalidate on
+ * path edits (already flagged through DRIVER_FLAG_INVALID handling) and on COW re-allocation of
+ * the target, which the key detects by pointer inequality. ID-name interning is a separate,
+ * smaller problem and belongs in BKE_main namemap, which already hashes names. */
 static float dtar_get_prop_val(const AnimationEvalContext *anim_eval_context,
                                ChannelDriver *driver,
                                DriverVar *dvar,
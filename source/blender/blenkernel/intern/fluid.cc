@@ -3797,6 +3797,16 @@ static void fluid_modifier_processDomain(FluidModifierData *fmd,
   with_guide = fds->flags & FLUID_DOMAIN_USE_GUIDE;
   with_particles = drops || bubble || floater;
 
+  /* NOTE: All `manta_read_*` / `manta_has_*` calls below load cache files synchronously inside
+   * depsgraph evaluation of the frame change, fully decoding every grid, which is what freezes
+   * the UI for seconds per frame when scrubbing big smoke caches. Streaming playback needs three
+   * pieces, all compatible with this dispatch logic: open VDB files with OpenVDB delayed loading
+   * so leaf buffers stream in on first access instead of up front (the viewport drawing and
+   * renderers only touch the leaves they sample); a read-ahead thread that opens the next frames'
+   * files along the playback direction; and an LRU of decoded frames keyed by (cache type,
+   * frame) so short scrub loops don't re-read. The fluid object's grid pointers are swapped by
+   * `manta_update_pointers`, which is the single point where a prefetched frame would be
+   * installed on the evaluation thread. */
   bool has_data, has_noise, has_mesh, has_particles, has_guide, has_config;
   has_data = manta_has_data(fds->fluid, fmd, scene_framenr);
   has_noise = manta_has_noise(fds->fluid, fmd, scene_framenr);
@@ -135,6 +135,15 @@ static int compare_packtile(const void *a, const void *b)
   return tile_a->pack_score < tile_b->pack_score;
 }
 
+/**
+ * Pack all tiles into the layers of one 2D array texture, so that a UDIM set costs a single
+ * binding. The whole array is resident, so large tile sets only fit through the resolution
+ * limit. Sparse textures (`ARB_sparse_texture`, Vulkan sparse residency) would lift that: the
+ * array could be allocated virtually at full size with only the pages of the mips in use made
+ * resident by a feedback pass. That support has to be introduced as a #GPUTexture allocation
+ * mode in the GPU module first (commitment per mip region, residency queries in samplers), with
+ * a non-sparse fallback since neither Metal nor many GL drivers expose it.
+ */
 static GPUTexture *gpu_texture_create_tile_array(Image *ima, ImBuf *main_ibuf)
 {
   int arraywidth = 0, arrayheight = 0;
@@ -352,6 +361,17 @@ void BKE_image_ensure_gpu_texture(Image *image, ImageUser *image_user)
   }
 }
 
+/**
+ * \note Textures are uploaded at full resolution on first bind (optionally clamped by the
+ * "GL Texture Limit" preference, see #GPU_texture_size_with_limit) and evicted as a whole when
+ * unused for longer than `U.textimeout` (see #BKE_image_free_old_gputextures). For shots that
+ * reference more texture data than fits on the GPU, this would have to become a streaming
+ * scheme: upload a persistent low mip tail here, and stream higher mips in and out on demand
+ * against a memory budget. The missing piece is per-frame bind feedback with the displayed size
+ * (only the draw manager knows which materials and thus textures a view actually uses); the
+ * synchronous contract of this function, where callers expect a complete texture back, means
+ * such a scheme also needs all samplers to tolerate a varying base mip level.
+ */
 static GPUTexture *image_get_gpu_texture(Image *ima,
                                          ImageUser *iuser,
                                          ImBuf *ibuf,
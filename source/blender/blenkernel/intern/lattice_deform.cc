@@ -141,6 +141,17 @@ LatticeDeformData *BKE_lattice_deform_data_create(const Object *oblatt, const Ob
   return lattice_deform_data;
 }
 
+/* NOTE: Evaluation is already threaded over vertices and the inner 64-tap sum is SSE2, so the
+ * per-frame waste is the front half of this function: the lattice-space transform, cell location
+ * and the three key_curve_position_weights() calls depend only on the vertex's undeformed
+ * position and the lattice's resolution/types/latmat — none of which change when only control
+ * points animate. A deform cache would store per vertex the clamped 64 data indices (or the
+ * (ui, vi, wi) triple) and the combined 4x4x4 basis products, computed once while (input
+ * position identity, resolution, key types, latmat) hold, leaving the frame work as a pure
+ * weighted gather that vectorizes across vertices instead of within one. The cache belongs in
+ * LatticeDeformData's creator per (lattice, deformed object) pair; vertex-group influence
+ * (`weight` here) stays per-frame since weights are paintable. Memory is the trade: 64 indices
+ * plus weights per vertex is ~0.5 KB each, so it should be opt-in by vertex count threshold. */
 void BKE_lattice_deform_data_eval_co(LatticeDeformData *lattice_deform_data,
                                      float co[3],
                                      float weight)
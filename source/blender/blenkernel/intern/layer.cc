@@ -1303,6 +1303,17 @@ void BKE_layer_collection_doversion_2_80(const Scene *scene, ViewLayer *view_lay
   }
 }
 
+/* NOTE: The flattened per-object visibility the request for bitsets asks for effectively exists:
+ * Base flags on the view layer are the resolved answer and are what the depsgraph and draw code
+ * consume. What makes checkbox toggles stall on collection-heavy files is that any change funnels
+ * into this full resync: the whole LayerCollection tree is matched against the collection tree
+ * via the LayerCollectionResync machinery, and all bases are rebuilt, regardless of what changed.
+ * The split that fixes it: flag-only changes (visibility/selectability toggles) do not alter the
+ * hierarchy or the base list, so they only need the flag-propagation part re-run over the
+ * affected subtree — the restore/propagate passes in layer_collection_sync() are already
+ * separable from the structural matching. Structural changes (collection add/remove/relink) keep
+ * the full resync. Routing that decision needs a dirty classification at the notifier call sites
+ * of BKE_main_collection_sync(); see also the lazy-resync TODO on the resync-forbid API above. */
 void BKE_layer_collection_sync(const Scene *scene, ViewLayer *view_layer)
 {
   if (no_resync) {
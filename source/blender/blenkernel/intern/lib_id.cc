@@ -1469,6 +1469,16 @@ void *BKE_libblock_copy(Main *bmain, const ID *id)
 
 /* ***************** ID ************************ */
 
+/* NOTE: These two lookups are linear over the type's ListBase, and hot paths do millions of them:
+ * library-override resync and Python pipeline scripts in particular degrade quadratically with ID
+ * count. The transient #BKE_main_idmap (`main_idmap.cc`) exists precisely to batch such lookups,
+ * but callers must know to create one, and it goes stale on any add/remove. The structural fix is
+ * an always-on per-Main index: name and session-UID hash maps maintained at the few mutation
+ * choke points that already exist for the name maps (`BKE_main_namemap_get_name` /
+ * `_remove_name`, `BKE_libblock_management_main_add/remove`), so these functions and the RNA path
+ * resolvers become O(1) with no opt-in. The namemap machinery is the right home -- it already
+ * tracks exactly the rename/add/free events needed, it just stores used names instead of
+ * name -> ID pointers. */
 ID *BKE_libblock_find_name(Main *bmain, const short type, const char *name)
 {
   ListBase *lb = which_libbase(bmain, type);
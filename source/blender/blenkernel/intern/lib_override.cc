@@ -3552,6 +3552,17 @@ static int lib_override_libraries_index_define(Main *bmain)
   return library_indirect_level_max;
 }
 
+/* NOTE: Resync processes hierarchies serially, and most of the wall time is
+ * #RNA_struct_override_matches diffing every property of every overridden ID against its
+ * reference. Two orthogonal speedups apply. The diff phase is read-only over both sides, so
+ * hierarchies with disjoint ID sets (the common case: distinct characters/assets in a shot) can
+ * diff in parallel once roots are grouped by reachability -- only the apply/rebuild phase
+ * mutates Main and must stay sequential. Independently, most sub-structs compare equal every
+ * resync; a content hash of the reference-side struct stored on the override operation data
+ * would let unchanged sub-trees skip property-by-property comparison entirely, invalidated by
+ * the library's session UID + file change. The RNA comparison code is reentrant for disjoint
+ * data, but the liboverride diffing currently records operations directly into ID runtime,
+ * which would need per-hierarchy accumulation before merging. */
 void BKE_lib_override_library_main_resync(Main *bmain,
                                           Scene *scene,
                                           ViewLayer *view_layer,
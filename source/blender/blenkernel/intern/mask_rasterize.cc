@@ -560,6 +560,17 @@ static void layer_bucket_init(MaskRasterLayer *layer, const float pixel_size)
   BLI_memarena_free(arena);
 }
 
+/* NOTE: Sampling the finished handle is already scanline-parallel (#BKE_maskrasterize_buffer);
+ * with many animated splines the time goes here instead, where every layer runs serially:
+ * spline/feather point evaluation (`BKE_mask_spline_differentiate_with_resolution` and the
+ * feather variant), scan-fill triangulation and bucket construction, all on one thread per
+ * handle build, every frame the mask animates. The structure is already parallel-friendly --
+ * layers are fully independent, and within a layer the per-spline differentiate/feather
+ * evaluation only writes its own point arrays -- so a `parallel_for` over layers (one scan-fill
+ * arena each, replacing the shared `sf_arena`) with nested per-spline evaluation gives the
+ * roto-heavy case its cores back. Only the final handle bounds union needs to happen after the
+ * join. Scan-fill itself stays serial per layer; it is arena-backed and not re-entrant on a
+ * shared context, which is also why the arena must move inside the loop before any of this. */
 void BKE_maskrasterize_handle_init(MaskRasterHandle *mr_handle,
                                    Mask *mask,
                                    const int width,
@@ -775,7 +775,21 @@ Mesh *BKE_mesh_new_nomain_from_template_ex(const Mesh *me_src,
   /* The destination mesh should at least have valid primary CD layers,
    * even in cases where the source mesh does not. */
   blender::bke::mesh_ensure_cdlayers_primary(*me_dst);
-  BKE_mesh_face_offsets_ensure_alloc(me_dst);
+  if (faces_num == me_src->faces_num && loops_num == me_src->corners_num &&
+      me_src->face_offset_indices != nullptr)
+  {
+    /* The source face offsets remain valid for the destination's face and corner counts, so share
+     * them instead of allocating a new array. They are un-shared on demand by
+     * #Mesh::face_offsets_for_write, and callers that change the topology overwrite them anyway.
+     */
+    blender::implicit_sharing::copy_shared_pointer(me_src->face_offset_indices,
+                                                   me_src->runtime->face_offsets_sharing_info,
+                                                   &me_dst->face_offset_indices,
+                                                   &me_dst->runtime->face_offsets_sharing_info);
+  }
+  else {
+    BKE_mesh_face_offsets_ensure_alloc(me_dst);
+  }
   if (do_tessface && !CustomData_get_layer(&me_dst->fdata_legacy, CD_MFACE)) {
     CustomData_add_layer(&me_dst->fdata_legacy, CD_MFACE, CD_SET_DEFAULT, me_dst->totface_legacy);
   }
@@ -719,18 +719,21 @@ static Mesh *imesh_to_mesh(IMesh *im, MeshesToIMeshInfo &mim)
       mim.meshes[0], out_totvert, 0, out_faces_num, out_totloop);
 
   merge_vertex_loop_face_customdata_layers(result, mim);
-  /* Set the vertex coordinate values and other data. */
+  /* Set the vertex coordinate values and other data. Every vertex only writes its own
+   * index in all layers, so this can be done in parallel. */
   MutableSpan<float3> positions = result->vert_positions_for_write();
-  for (int vi : im->vert_index_range()) {
-    const Vert *v = im->vert(vi);
-    if (v->orig != NO_INDEX) {
-      const Mesh *orig_me;
-      int index_in_orig_me;
-      mim.input_mvert_for_orig_index(v->orig, &orig_me, &index_in_orig_me);
-      copy_vert_attributes(result, orig_me, vi, index_in_orig_me);
+  threading::parallel_for(im->vert_index_range(), 2048, [&](IndexRange range) {
+    for (int vi : range) {
+      const Vert *v = im->vert(vi);
+      if (v->orig != NO_INDEX) {
+        const Mesh *orig_me;
+        int index_in_orig_me;
+        mim.input_mvert_for_orig_index(v->orig, &orig_me, &index_in_orig_me);
+        copy_vert_attributes(result, orig_me, vi, index_in_orig_me);
+      }
+      copy_v3fl_v3db(positions[vi], v->co);
     }
-    copy_v3fl_v3db(positions[vi], v->co);
-  }
+  });
 
   /* Set the loop-start and total-loops for each output face,
    * and set the vertices in the appropriate loops. */
@@ -22,6 +22,7 @@
 #include "BLI_linklist.h"
 #include "BLI_math_base.hh"
 #include "BLI_math_vector.hh"
+#include "BLI_math_vector_simd.hh"
 #include "BLI_memarena.h"
 #include "BLI_span.hh"
 #include "BLI_task.hh"
@@ -171,7 +172,7 @@ void normals_calc_verts(const Span<float3> vert_positions,
     for (const int vert : range) {
       const Span<int> vert_faces = vert_to_face_map[vert];
       if (vert_faces.is_empty()) {
-        vert_normals[vert] = math::normalize(positions[vert]);
+        vert_normals[vert] = positions[vert];
         continue;
       }
 
@@ -185,8 +186,11 @@ void normals_calc_verts(const Span<float3> vert_positions,
         vert_normal += face_normals[face] * factor;
       }
 
-      vert_normals[vert] = math::normalize(vert_normal);
+      vert_normals[vert] = vert_normal;
     }
+    /* Accumulate unnormalized sums above (for loose vertices the position is used as before), so
+     * the normalization runs over contiguous memory and can use the SIMD kernel. */
+    math::normalize_span(vert_normals.slice(range));
   });
 }
 
@@ -1205,6 +1205,24 @@ static float mesh_remap_calc_loops_astar_f_cost(BLI_AStarGraph *as_graph,
 
 #define ASTAR_STEPS_MAX 64
 
+/* NOTE: This is the data-transfer hot path and it is serial end to end: one BVH query per
+ * destination loop (or face sample), with per-element temporaries allocated and freed inside the
+ * loop (`vcos_interp`, indices, weights), and the whole mapping recomputed from scratch every
+ * time the modifier re-evaluates even when neither topology changed. Three independent fixes,
+ * in order of payoff:
+ *
+ * - Parallelize over destination faces: iterations only write their own #MeshPairRemap items
+ *   and the A* island state is read-only after setup, so a `parallel_for` over face ranges with
+ *   one arena per grain for the temporaries fits without restructuring.
+ * - Hoist the per-element allocations into those per-grain arenas; at game-res loop counts the
+ *   malloc traffic is comparable to the query cost.
+ * - Cache the computed #MeshPairRemap on the modifier runtime keyed by (source/destination
+ *   topology hashes, mode, space transform, max_dist): repeated evaluations with unchanged
+ *   meshes -- the common case when tweaking something upstream of the *data*, not the geometry
+ *   -- then skip this function entirely. Weights are positional, so the key must include
+ *   positions for the non-topology modes (implicit-sharing identity of the position arrays is
+ *   the cheap conservative test).
+ */
 void BKE_mesh_remap_calc_loops_from_mesh(const int mode,
                                          const SpaceTransform *space_transform,
                                          const float max_dist,
@@ -170,6 +170,18 @@ Mesh *BKE_mesh_remesh_quadriflow(const Mesh *mesh,
 }
 
 #ifdef WITH_OPENVDB
+/* NOTE: The whole remesh is one shot: full input copied into OpenVDB point/triangle vectors, one
+ * meshToLevelSet over everything, one volumeToMesh back -- so peak memory is the dense-ish
+ * narrow band of the entire model at once, which is what makes fine voxel sizes need outsized
+ * machines. OpenVDB's own primitives already cover the internal parallelism (both conversions
+ * are TBB-threaded); the memory bound needs tiling on top: partition the input triangles into
+ * leaf-aligned regions padded by the narrow-band width, convert and mesh each region separately,
+ * and merge. The subtle part is seams -- volumeToMesh must see identical signed distances in the
+ * overlap for the extracted surfaces to coincide, so regions have to be cut from one consistent
+ * transform and the extraction clamped to interior bounds (`volumeToMesh` has no clip argument;
+ * clipping the grid with `tools::clip` before extraction is the supported route), with vertex
+ * welding on the shared boundary afterwards. Tiles are independent, so they both bound memory
+ * (process k at a time) and use all cores between tiles. */
 static openvdb::FloatGrid::Ptr remesh_voxel_level_set_create(const Mesh *mesh,
                                                              const float voxel_size)
 {
@@ -113,6 +113,17 @@ static void try_tag_verts_no_face_none(const Mesh &mesh)
   });
 }
 
+/**
+ * Triangulation only reads vertex positions for faces with more than three corners (the diagonal
+ * flip for degenerate quads and the ear clipping of ngons). Since every face has at least three
+ * corners, the corner count can only be three times the face count when every face is a triangle,
+ * so this is a constant time check.
+ */
+static bool corner_tris_independent_of_positions(const Mesh &mesh)
+{
+  return mesh.corners_num == mesh.faces_num * 3;
+}
+
 }  // namespace blender::bke
 
 blender::Span<int> Mesh::corner_to_face_map() const
@@ -361,7 +372,9 @@ void Mesh::tag_positions_changed()
 void Mesh::tag_positions_changed_no_normals()
 {
   free_bvh_cache(*this->runtime);
-  this->runtime->corner_tris_cache.tag_dirty();
+  if (!blender::bke::corner_tris_independent_of_positions(*this)) {
+    this->runtime->corner_tris_cache.tag_dirty();
+  }
   this->runtime->bounds_cache.tag_dirty();
 }
 
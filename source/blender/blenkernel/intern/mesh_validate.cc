@@ -6,6 +6,7 @@
  * \ingroup bke
  */
 
+#include <algorithm>
 #include <climits>
 #include <cstdio>
 #include <cstdlib>
@@ -17,13 +18,17 @@
 #include "DNA_meshdata_types.h"
 #include "DNA_object_types.h"
 
+#include "BLI_array.hh"
 #include "BLI_bitmap.h"
 #include "BLI_map.hh"
 #include "BLI_math_base.h"
 #include "BLI_math_vector.h"
 #include "BLI_ordered_edge.hh"
+#include "BLI_sort.hh"
 #include "BLI_sys_types.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 #include "BLI_vector_set.hh"
 
 #include "BKE_attribute.hh"
@@ -192,6 +197,248 @@ static int search_polyloop_cmp(const void *v1, const void *v2)
 
 /** \} */
 
+/* -------------------------------------------------------------------- */
+/** \name Parallel Validity Pre-Check
+ * \{ */
+
+/**
+ * Mix a vertex index into 64 bits so that summing the mixed values of a face's corner vertices
+ * gives an order-independent key for the face's vertex set. Faces using the same vertices always
+ * get the same key, so unique keys prove there are no duplicate faces.
+ */
+static uint64_t validate_vert_index_mix(const int vert)
+{
+  uint64_t x = uint64_t(uint(vert)) * 0x9E3779B97F4A7C15ull;
+  x ^= x >> 32;
+  return x * 0xBF58476D1CE4E5B9ull;
+}
+
+/**
+ * Read-only parallel check covering everything #BKE_mesh_validate_arrays can detect, except the
+ * legacy tessellated face checks. A true result proves the arrays are fully valid so the serial
+ * fixing pass can be skipped. A false result only means a problem is possible: the duplicate
+ * checks compare sorted keys, so a rare hash collision makes this conservatively fall back to
+ * the full pass rather than weakening validation.
+ */
+static bool mesh_validate_arrays_fast_check(const Mesh *mesh,
+                                            const float (*vert_positions)[3],
+                                            const uint verts_num,
+                                            const blender::int2 *edges,
+                                            const uint edges_num,
+                                            const int *corner_verts,
+                                            const int *corner_edges,
+                                            const uint corners_num,
+                                            const int *face_offsets,
+                                            const uint faces_num,
+                                            const MDeformVert *dverts,
+                                            const blender::Span<int> material_indices)
+{
+  using namespace blender;
+
+  if (edges_num == 0 && faces_num != 0) {
+    return false;
+  }
+  /* The full pass flags unused and multi-used loops, so the faces must partition the loops. */
+  if (faces_num == 0) {
+    if (corners_num != 0) {
+      return false;
+    }
+  }
+  else if (face_offsets[0] != 0 || uint(face_offsets[faces_num]) != corners_num) {
+    return false;
+  }
+
+  const auto and_reduce = [](const bool a, const bool b) { return a && b; };
+
+  const bool verts_valid = threading::parallel_reduce(
+      IndexRange(verts_num),
+      4096,
+      true,
+      [&](const IndexRange range, bool valid) {
+        for (const int64_t i : range) {
+          if (!(isfinite(vert_positions[i][0]) && isfinite(vert_positions[i][1]) &&
+                isfinite(vert_positions[i][2])))
+          {
+            return false;
+          }
+          if (dverts) {
+            const MDeformVert &dv = dverts[i];
+            for (int j = 0; j < dv.totweight; j++) {
+              const MDeformWeight &dw = dv.dw[j];
+              if (!isfinite(dw.weight) || dw.weight < 0.0f || dw.weight > 1.0f ||
+                  dw.def_nr >= INT_MAX)
+              {
+                return false;
+              }
+            }
+          }
+        }
+        return valid;
+      },
+      and_reduce);
+  if (!verts_valid) {
+    return false;
+  }
+
+  Array<uint64_t> edge_keys(edges_num);
+  const bool edges_valid = threading::parallel_reduce(
+      IndexRange(edges_num),
+      4096,
+      true,
+      [&](const IndexRange range, bool valid) {
+        for (const int64_t i : range) {
+          const int2 edge = edges[i];
+          if (uint(edge[0]) >= verts_num || uint(edge[1]) >= verts_num || edge[0] == edge[1]) {
+            return false;
+          }
+          const uint64_t lo = uint64_t(std::min(edge[0], edge[1]));
+          const uint64_t hi = uint64_t(std::max(edge[0], edge[1]));
+          edge_keys[i] = (lo << 32) | hi;
+        }
+        return valid;
+      },
+      and_reduce);
+  if (!edges_valid) {
+    return false;
+  }
+  if (edges_num > 1) {
+    parallel_sort(edge_keys.as_mutable_span());
+    const bool edges_unique = threading::parallel_reduce(
+        IndexRange(1, edges_num - 1),
+        4096,
+        true,
+        [&](const IndexRange range, bool valid) {
+          for (const int64_t i : range) {
+            if (edge_keys[i] == edge_keys[i - 1]) {
+              return false;
+            }
+          }
+          return valid;
+        },
+        and_reduce);
+    if (!edges_unique) {
+      return false;
+    }
+  }
+
+  Array<uint64_t> face_keys(faces_num);
+  const bool faces_valid = threading::parallel_reduce(
+      IndexRange(faces_num),
+      1024,
+      true,
+      [&](const IndexRange range, bool valid) {
+        Vector<int, 16> sorted_verts;
+        for (const int64_t i : range) {
+          const int start = face_offsets[i];
+          const int size = face_offsets[i + 1] - start;
+          if (size < 3) {
+            return false;
+          }
+          uint64_t key = 0;
+          for (int j = 0; j < size; j++) {
+            const int vert = corner_verts[start + j];
+            if (uint(vert) >= verts_num) {
+              return false;
+            }
+            /* A corner's edge must reference a matching valid edge; since all edges were
+             * validated above, this also proves no face needs a missing edge. */
+            const int edge_i = corner_edges[start + j];
+            if (uint(edge_i) >= edges_num) {
+              return false;
+            }
+            const int vert_next = corner_verts[start + (j + 1) % size];
+            const int2 edge = edges[edge_i];
+            if (!((edge[0] == vert && edge[1] == vert_next) ||
+                  (edge[0] == vert_next && edge[1] == vert)))
+            {
+              return false;
+            }
+            key += validate_vert_index_mix(vert);
+          }
+          sorted_verts.clear();
+          sorted_verts.extend(Span<int>(corner_verts + start, size));
+          std::sort(sorted_verts.begin(), sorted_verts.end());
+          for (int j = 1; j < size; j++) {
+            if (sorted_verts[j] == sorted_verts[j - 1]) {
+              return false;
+            }
+          }
+          face_keys[i] = key;
+        }
+        return valid;
+      },
+      and_reduce);
+  if (!faces_valid) {
+    return false;
+  }
+  if (faces_num > 1) {
+    parallel_sort(face_keys.as_mutable_span());
+    const bool faces_unique = threading::parallel_reduce(
+        IndexRange(1, faces_num - 1),
+        4096,
+        true,
+        [&](const IndexRange range, bool valid) {
+          for (const int64_t i : range) {
+            if (face_keys[i] == face_keys[i - 1]) {
+              return false;
+            }
+          }
+          return valid;
+        },
+        and_reduce);
+    if (!faces_unique) {
+      return false;
+    }
+  }
+
+  if (!material_indices.is_empty()) {
+    const bool materials_valid = threading::parallel_reduce(
+        material_indices.index_range(),
+        4096,
+        true,
+        [&](const IndexRange range, bool valid) {
+          for (const int64_t i : range) {
+            if (material_indices[i] < 0) {
+              return false;
+            }
+          }
+          return valid;
+        },
+        and_reduce);
+    if (!materials_valid) {
+      return false;
+    }
+  }
+
+  if (mesh && mesh->mselect) {
+    for (int i = 0; i < mesh->totselect; i++) {
+      const MSelect &msel = mesh->mselect[i];
+      if (msel.index < 0) {
+        return false;
+      }
+      int tot_elem = 0;
+      switch (msel.type) {
+        case ME_VSEL:
+          tot_elem = mesh->verts_num;
+          break;
+        case ME_ESEL:
+          tot_elem = mesh->edges_num;
+          break;
+        case ME_FSEL:
+          tot_elem = mesh->faces_num;
+          break;
+      }
+      if (msel.index > tot_elem) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+/** \} */
+
 /* -------------------------------------------------------------------- */
 /** \name Mesh Validation
  * \{ */
@@ -250,6 +497,33 @@ bool BKE_mesh_validate_arrays(Mesh *mesh,
       mesh->attributes_for_write().lookup_for_write<int>("material_index");
   blender::MutableVArraySpan<int> material_indices_span(material_indices.varray);
 
+  /* When the read-only parallel pre-check proves every array valid, the serial checks and their
+   * fix-up bookkeeping below are unnecessary. This is the common case for meshes coming from
+   * importers, where validation time is dominated by large meshes that need no fixing. */
+  if (legacy_faces_num == 0 && (legacy_faces == nullptr || face_offsets != nullptr) &&
+      (face_offsets != nullptr || faces_num == 0) &&
+      mesh_validate_arrays_fast_check(mesh,
+                                      vert_positions,
+                                      verts_num,
+                                      edges,
+                                      edges_num,
+                                      corner_verts,
+                                      corner_edges,
+                                      corners_num,
+                                      face_offsets,
+                                      faces_num,
+                                      dverts,
+                                      material_indices_span))
+  {
+    material_indices_span.save();
+    material_indices.finish();
+    if (do_verbose) {
+      CLOG_INFO(&LOG, 1, "%s: all arrays valid, skipped detailed pass", __func__);
+    }
+    *r_changed = false;
+    return true;
+  }
+
 #if 0
   const blender::OffsetIndices<int> faces({face_offsets, faces_num + 1});
   for (const int i : faces.index_range()) {
@@ -36,6 +36,7 @@
 #include "BLI_linklist.h"
 #include "BLI_listbase.h"
 #include "BLI_path_util.h"
+#include "BLI_profile.hh"
 #include "BLI_session_uuid.h"
 #include "BLI_string.h"
 #include "BLI_string_utf8.h"
@@ -919,6 +920,8 @@ static void modwrap_dependsOnNormals(Mesh *mesh)
 Mesh *BKE_modifier_modify_mesh(ModifierData *md, const ModifierEvalContext *ctx, Mesh *mesh)
 {
   const ModifierTypeInfo *mti = BKE_modifier_get_info(ModifierType(md->type));
+  /* The type info is static data, so its name is safe to keep in the profile buffer. */
+  BLI_PROFILE_SCOPE(mti->name, "modifier");
 
   if (mesh->runtime->wrapper_type == ME_WRAPPER_TYPE_BMESH) {
     if ((mti->flags & eModifierTypeFlag_AcceptsBMesh) == 0) {
@@ -938,6 +941,7 @@ void BKE_modifier_deform_verts(ModifierData *md,
                                blender::MutableSpan<blender::float3> positions)
 {
   const ModifierTypeInfo *mti = BKE_modifier_get_info(ModifierType(md->type));
+  BLI_PROFILE_SCOPE(mti->name, "modifier");
   if (mesh && mti->depends_on_normals && mti->depends_on_normals(md)) {
     modwrap_dependsOnNormals(mesh);
   }
@@ -638,6 +638,17 @@ bool BKE_ocean_is_valid(const Ocean *o)
   return o->_k != nullptr;
 }
 
+/* NOTE: Parallelism here is per-component (each displacement/jacobian/normal FFT is one task in
+ * the pool below), so the wall time is bounded by one serial FFT of the full resolution --
+ * at resolution 512 that serial transform is most of the frame cost. Each individual transform
+ * can be threaded without restructuring this file: FFTW's threaded variant only changes plan
+ * creation (`fftw_init_threads` once at startup, `fftw_plan_with_nthreads` where the plans are
+ * built in `BKE_ocean_init`), though planning itself is not thread-safe and must stay under a
+ * global guard, and accumulated wisdom should persist per resolution next to the cache so
+ * re-opening a shot doesn't re-plan. Independently, the disk/memory cache stores full-float
+ * frames; displacement and foam tolerate half precision, so writing the cache EXRs as half and
+ * widening on read in #BKE_ocean_cache_eval_ij would halve #OceanCache size -- but the format
+ * choice must be versioned in the baked files, since existing bakes are full float. */
 void BKE_ocean_simulate(Ocean *o, float t, float scale, float chop_amount)
 {
   TaskPool *pool;
@@ -1657,6 +1657,12 @@ static void sculpt_update_object(Depsgraph *depsgraph,
   Mesh *mesh = BKE_object_get_original_mesh(ob);
   Mesh *me_eval = BKE_object_get_evaluated_mesh(ob_eval);
   MultiresModifierData *mmd = sculpt_multires_modifier_get(scene, ob, true);
+
+  if (ss->pbvh) {
+    /* The data rebuilt below is read by a deferred normal update, if one is still running. */
+    blender::bke::pbvh::update_normals_join(*ss->pbvh);
+  }
+
   const bool use_face_sets = (ob->mode & OB_MODE_SCULPT) != 0;
 
   BLI_assert(me_eval != nullptr);
@@ -1863,6 +1869,11 @@ void BKE_sculpt_update_object_before_eval(Object *ob_eval)
   /* Update before mesh evaluation in the dependency graph. */
   SculptSession *ss = ob_eval->sculpt;
 
+  if (ss && ss->pbvh) {
+    /* Evaluation may free or rebuild data the deferred normal update reads. */
+    blender::bke::pbvh::update_normals_join(*ss->pbvh);
+  }
+
   if (ss && ss->building_vp_handle == false) {
     if (!ss->cache && !ss->filter_cache && !ss->expand_cache) {
       /* We free pbvh on changes, except in the middle of drawing a stroke
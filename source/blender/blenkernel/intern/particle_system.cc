@@ -3848,6 +3848,16 @@ static void dynamics_step_sph_classical_integrate_task_cb_ex(void *__restrict us
 }
 
 /* unbaked particles are calculated dynamically */
+/* NOTE: The Newtonian path below iterates #ParticleData, a large AoS struct (state, previous
+ * state, hair, boid pointers...), so integration touches a full cache line per particle for a
+ * handful of floats and the compiler cannot vectorize across particles. For the pure Newtonian
+ * case (#basic_integrate with no boids/fluid/hair involvement), the profitable layout is an SoA
+ * mirror owned by the step: gather position/velocity/lifetime into contiguous arrays once,
+ * integrate and accumulate forces over those with a parallel range (effector evaluation is
+ * already per-particle independent there), and scatter back into `pa->state` at the end of the
+ * step so everything downstream -- caching, render, Python -- keeps seeing ParticleData.
+ * Gather/scatter is O(n) and amortizes over the many integrator substeps per frame; boids and
+ * SPH stay on the AoS path since their neighbor queries use per-particle structs. */
 static void dynamics_step(ParticleSimulationData *sim, float cfra)
 {
   ParticleSystem *psys = sim->psys;
@@ -878,6 +878,11 @@ void free(PBVH *pbvh)
 
   pixels_free(pbvh);
 
+  if (pbvh->normals_update_pool) {
+    BLI_task_pool_work_and_wait(pbvh->normals_update_pool);
+    BLI_task_pool_free(pbvh->normals_update_pool);
+  }
+
   delete pbvh;
 }
 
@@ -1221,7 +1226,7 @@ static void pbvh_faces_update_normals(PBVH &pbvh, Span<PBVHNode *> nodes, Mesh &
   }
 }
 
-void update_normals(PBVH &pbvh, SubdivCCG *subdiv_ccg)
+static void update_normals_impl(PBVH &pbvh, SubdivCCG *subdiv_ccg)
 {
   Vector<PBVHNode *> nodes = search_gather(
       &pbvh, [&](PBVHNode &node) { return update_search(&node, PBVH_UpdateNormals); });
@@ -1242,6 +1247,35 @@ void update_normals(PBVH &pbvh, SubdivCCG *subdiv_ccg)
   }
 }
 
+void update_normals(PBVH &pbvh, SubdivCCG *subdiv_ccg)
+{
+  update_normals_join(pbvh);
+  update_normals_impl(pbvh, subdiv_ccg);
+}
+
+static void update_normals_task_cb(TaskPool *__restrict pool, void * /*taskdata*/)
+{
+  PBVH *pbvh = static_cast<PBVH *>(BLI_task_pool_user_data(pool));
+  update_normals_impl(*pbvh, pbvh->normals_update_subdiv_ccg);
+}
+
+void update_normals_async(PBVH &pbvh, SubdivCCG *subdiv_ccg)
+{
+  update_normals_join(pbvh);
+  if (!pbvh.normals_update_pool) {
+    pbvh.normals_update_pool = BLI_task_pool_create_background(&pbvh, TASK_PRIORITY_HIGH);
+  }
+  pbvh.normals_update_subdiv_ccg = subdiv_ccg;
+  BLI_task_pool_push(pbvh.normals_update_pool, update_normals_task_cb, nullptr, false, nullptr);
+}
+
+void update_normals_join(PBVH &pbvh)
+{
+  if (pbvh.normals_update_pool) {
+    BLI_task_pool_work_and_wait(pbvh.normals_update_pool);
+  }
+}
+
 static void node_update_bounds(PBVH &pbvh, PBVHNode &node, const PBVHNodeFlags flag)
 {
   if ((flag & PBVH_UpdateBB) && (node.flag & PBVH_UpdateBB)) {
@@ -1630,22 +1664,25 @@ int BKE_pbvh_get_grid_num_faces(const PBVH *pbvh)
 void BKE_pbvh_node_mark_update(PBVHNode *node)
 {
   node->flag |= PBVH_UpdateNormals | PBVH_UpdateBB | PBVH_UpdateOriginalBB |
-                PBVH_UpdateDrawBuffers | PBVH_UpdateRedraw | PBVH_RebuildPixels;
+                PBVH_UpdateDrawBuffers | PBVH_UpdateDrawPositions | PBVH_UpdateRedraw |
+                PBVH_RebuildPixels;
 }
 
 void BKE_pbvh_node_mark_update_mask(PBVHNode *node)
 {
-  node->flag |= PBVH_UpdateMask | PBVH_UpdateDrawBuffers | PBVH_UpdateRedraw;
+  node->flag |= PBVH_UpdateMask | PBVH_UpdateDrawBuffers | PBVH_UpdateDrawMask |
+                PBVH_UpdateRedraw;
 }
 
 void BKE_pbvh_node_mark_update_color(PBVHNode *node)
 {
-  node->flag |= PBVH_UpdateColor | PBVH_UpdateDrawBuffers | PBVH_UpdateRedraw;
+  node->flag |= PBVH_UpdateColor | PBVH_UpdateDrawBuffers | PBVH_UpdateDrawAttributes |
+                PBVH_UpdateRedraw;
 }
 
 void BKE_pbvh_node_mark_update_face_sets(PBVHNode *node)
 {
-  node->flag |= PBVH_UpdateDrawBuffers | PBVH_UpdateRedraw;
+  node->flag |= PBVH_UpdateDrawBuffers | PBVH_UpdateDrawFaceSets | PBVH_UpdateRedraw;
 }
 
 void BKE_pbvh_mark_rebuild_pixels(PBVH *pbvh)
@@ -2628,6 +2665,40 @@ static blender::draw::pbvh::PBVH_GPU_Args pbvh_draw_args_init(const Mesh &mesh,
 
 namespace blender::bke::pbvh {
 
+/**
+ * Find which vertex buffer contents actually changed for a node, so unchanged attributes don't
+ * have to be re-extracted and re-uploaded. Dyntopo mixes topology updates into the same flag
+ * without scope information, so BMesh nodes always update everything, as do nodes whose update
+ * was requested without a scope.
+ */
+static blender::draw::pbvh::UpdateScope node_update_scope(const PBVH &pbvh, const PBVHNode &node)
+{
+  using blender::draw::pbvh::UpdateScope;
+  if (pbvh.header.type == PBVH_BMESH) {
+    return UpdateScope::All;
+  }
+  if (node.flag & PBVH_RebuildDrawBuffers) {
+    return UpdateScope::All;
+  }
+  UpdateScope scope = UpdateScope(0);
+  if (node.flag & PBVH_UpdateDrawPositions) {
+    scope |= UpdateScope::Positions;
+  }
+  if (node.flag & PBVH_UpdateDrawMask) {
+    scope |= UpdateScope::Mask;
+  }
+  if (node.flag & PBVH_UpdateDrawFaceSets) {
+    scope |= UpdateScope::FaceSets;
+  }
+  if (node.flag & PBVH_UpdateDrawAttributes) {
+    scope |= UpdateScope::Attributes;
+  }
+  if (scope == UpdateScope(0)) {
+    return UpdateScope::All;
+  }
+  return scope;
+}
+
 static void node_update_draw_buffers(const Mesh &mesh, PBVH &pbvh, PBVHNode &node)
 {
   /* Create and update draw buffers. The functions called here must not
@@ -2643,7 +2714,7 @@ static void node_update_draw_buffers(const Mesh &mesh, PBVH &pbvh, PBVHNode &nod
 
     if (node.draw_batches) {
       const blender::draw::pbvh::PBVH_GPU_Args args = pbvh_draw_args_init(mesh, pbvh, node);
-      blender::draw::pbvh::node_update(node.draw_batches, args);
+      blender::draw::pbvh::node_update(node.draw_batches, args, node_update_scope(pbvh, node));
     }
   }
 }
@@ -2695,7 +2766,9 @@ static void pbvh_update_draw_buffers(const Mesh &mesh,
       }
     }
 
-    node->flag &= ~(PBVH_RebuildDrawBuffers | PBVH_UpdateDrawBuffers);
+    node->flag &= ~(PBVH_RebuildDrawBuffers | PBVH_UpdateDrawBuffers |
+                    PBVH_UpdateDrawPositions | PBVH_UpdateDrawMask | PBVH_UpdateDrawFaceSets |
+                    PBVH_UpdateDrawAttributes);
   }
 }
 
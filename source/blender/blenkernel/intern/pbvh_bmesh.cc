@@ -2216,6 +2216,17 @@ PBVH *build_bmesh(BMesh *bm,
   return pbvh.release();
 }
 
+/* NOTE: Topology updates are serial not because of an explicit lock but because everything
+ * funnels through shared mutable structures: one global edge priority queue, the BMesh element
+ * pools (BLI_mempool allocation is not thread-safe), and the vert/face→node back-pointers that
+ * splits/collapses rewrite on both sides of an edge. Node-scoped concurrency is plausible
+ * because the PBVH already partitions faces spatially: color the leaf nodes inside the brush
+ * radius so no two same-color nodes share boundary verts, give each worker a per-thread element
+ * pool and a per-node local queue, run colors as sequential parallel waves, and queue any edge
+ * whose neighborhood leaves the node into a serial epilogue (the same classification
+ * #pbvh_bmesh_node_vert_use_count_at_most already performs for ownership). The hard constraint
+ * is BMesh itself: toolflags and the global element indices are process-wide, so BM_ALLOC-side
+ * work needs the per-thread pools to be merged back before anything else touches the mesh. */
 bool bmesh_update_topology(PBVH *pbvh,
                            PBVHTopologyUpdateMode mode,
                            const float center[3],
@@ -22,6 +22,7 @@ struct PBVHBatches;
 struct PBVHGPUFormat;
 struct BMVert;
 struct BMFace;
+struct TaskPool;
 
 /* NOTE: this structure is getting large, might want to split it into
  * union'd structs */
@@ -196,6 +197,11 @@ struct PBVH {
   /* Used by DynTopo to invalidate the draw cache. */
   bool draw_cache_invalid = true;
 
+  /** Runs a deferred normal update started by #blender::bke::pbvh::update_normals_async. */
+  TaskPool *normals_update_pool = nullptr;
+  /** Subdiv data captured for the in-flight deferred normal update. */
+  SubdivCCG *normals_update_subdiv_ccg = nullptr;
+
   PBVHGPUFormat *vbo_id;
 
   PBVHPixels pixels;
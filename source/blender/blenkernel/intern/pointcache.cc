@@ -1805,6 +1805,16 @@ int BKE_ptcache_mem_pointers_seek(int point_index, PTCacheMem *pm, void *cur[BPH
 
   return 1;
 }
+/* NOTE: Memory caching keeps every frame's arrays raw in RAM for the whole session; compression
+ * only exists on the explicit disk path (#ptcache_file_compressed_write), so long cloth/hair
+ * reviews hold tens of gigabytes of mostly idle frames. The per-frame arrays here are the right
+ * granularity to fix that transparently: frames outside a window around the current frame can
+ * hold their `pm->data` arrays compressed (fast codec for recently used frames, stronger one for
+ * cold frames) and decompress in #BKE_ptcache_mem_pointers_init / `_seek` on access, which are
+ * the only entry points that hand out raw pointers. A further spill tier would move cold
+ * compressed frames into the existing disk-cache file format in a background thread, under a
+ * global byte budget shared across all caches, with read-ahead along the playback direction.
+ * Simulation itself always reads/writes the current window, so the hot path stays raw. */
 static void ptcache_data_alloc(PTCacheMem *pm)
 {
   int data_types = pm->data_types;
@@ -98,6 +98,18 @@ bool BKE_shrinkwrap_needs_normals(int shrinkType, int shrinkMode)
           shrinkMode == MOD_SHRINKWRAP_ABOVE_SURFACE);
 }
 
+/* NOTE: Rigid target motion already avoids rebuilds by construction: queries run in the target's
+ * local space through a #SpaceTransform, and the trees requested below come from the mesh
+ * runtime BVH cache, which survives as long as the evaluated target mesh does. The per-frame
+ * rebuilds seen in retopo setups happen when the depsgraph re-creates the target's evaluated
+ * mesh even though its geometry is unchanged -- a rig where only object-level or non-deforming
+ * channels animate still re-evaluates the mesh and drops its runtime caches. The fix therefore
+ * lives upstream of this file: carry the runtime BVH cache across re-evaluations whose
+ * positions are verifiably unchanged (implicit-sharing identity of the position array is the
+ * cheap test). The other win is local: the nearest-surface loop issues one BVH query per vertex,
+ * and batching queries per task chunk to amortize the descent (see the BVH request design in
+ * `BLI_kdopbvh.h` users) fits in `shrinkwrap_calc_nearest_surface_point` without layout
+ * changes. */
 bool BKE_shrinkwrap_init_tree(
     ShrinkwrapTreeData *data, Mesh *mesh, int shrinkType, int shrinkMode, bool force_normals)
 {
@@ -929,6 +929,19 @@ void BKE_sound_stop_scene(Scene *scene)
   }
 }
 
+/* NOTE: Audio dropouts while scrubbing come from the locking model, not from mixing cost. The
+ * sequence of AUD_Device_lock() .. AUD_Device_unlock() below holds the device mutex from the main
+ * thread while handles are restarted, and audaspace's SoftwareDevice::mix() takes the same mutex
+ * inside the audio callback (extern/audaspace/src/devices/SoftwareDevice.cpp), so a slow seek on
+ * the main thread makes the callback miss its deadline and the output crackles.
+ *
+ * The fix belongs in audaspace (upstream library, keep changes there): an RCU-style snapshot of
+ * the playing-handle list, where setters publish a new immutable list via an atomic pointer and
+ * mix() reads whichever version is current without blocking, retiring old versions after the
+ * callback cycles. On the Blender side this function would then drop the explicit device lock and
+ * issue the seek/resume calls as one published update. Vectorizing the JOS resampler inner
+ * product is worthwhile independently, but it only shrinks the window, it does not remove the
+ * priority inversion. */
 void BKE_sound_seek_scene(Main *bmain, Scene *scene)
 {
   sound_verify_evaluated_id(&scene->id);
@@ -8,11 +8,15 @@
 
 #include "BKE_subdiv.hh"
 
+#include <algorithm>
+
 #include "DNA_mesh_types.h"
 #include "DNA_modifier_types.h"
 
 #include "BLI_utildefines.h"
 
+#include "BKE_customdata.hh"
+#include "BKE_mesh_types.hh"
 #include "BKE_modifier.hh"
 #include "BKE_subdiv_modifier.hh"
 
@@ -89,6 +93,137 @@ bool BKE_subdiv_settings_equal(const SubdivSettings *settings_a, const SubdivSet
           settings_a->fvar_linear_interpolation == settings_b->fvar_linear_interpolation);
 }
 
+/* --------------------------------------------------------------------
+ * Topology identity.
+ */
+
+/* Collect the arrays the mesh converter reads into \a r_identity, without pinning them.
+ * Returns false when the identity can not represent the mesh, in which case reuse detection
+ * must fall back to the element-wise topology comparison. */
+static bool topology_identity_collect(const SubdivSettings *settings,
+                                      const Mesh *mesh,
+                                      SubdivTopologyIdentity *r_identity)
+{
+  r_identity->verts_num = mesh->verts_num;
+  r_identity->edges_num = mesh->edges_num;
+  r_identity->faces_num = mesh->faces_num;
+  r_identity->corners_num = mesh->corners_num;
+  r_identity->optional_layers_mask = 0;
+  r_identity->arrays_num = 0;
+
+  const auto add_array = [&](const void *data, const ImplicitSharingInfoHandle *sharing_info) {
+    if (data == nullptr || sharing_info == nullptr) {
+      return false;
+    }
+    if (r_identity->arrays_num == SUBDIV_TOPOLOGY_IDENTITY_MAX_ARRAYS) {
+      return false;
+    }
+    r_identity->arrays[r_identity->arrays_num] = data;
+    r_identity->sharing_infos[r_identity->arrays_num] = sharing_info;
+    r_identity->arrays_num++;
+    return true;
+  };
+  const auto add_layer = [&](const CustomData *data,
+                             const eCustomDataType type,
+                             const char *name,
+                             const int presence_bit) {
+    const int index = CustomData_get_named_layer_index(data, type, name);
+    if (index == -1) {
+      /* A missing layer is identified by its cleared presence bit. */
+      return true;
+    }
+    r_identity->optional_layers_mask |= presence_bit;
+    const CustomDataLayer &layer = data->layers[index];
+    return add_array(layer.data, layer.sharing_info);
+  };
+
+  if (mesh->faces_num != 0) {
+    if (!add_array(mesh->face_offset_indices, mesh->runtime->face_offsets_sharing_info)) {
+      return false;
+    }
+  }
+  if (!add_layer(&mesh->edge_data, CD_PROP_INT32_2D, ".edge_verts", 1 << 0)) {
+    return false;
+  }
+  if (!add_layer(&mesh->corner_data, CD_PROP_INT32, ".corner_vert", 1 << 1)) {
+    return false;
+  }
+  if (!add_layer(&mesh->corner_data, CD_PROP_INT32, ".corner_edge", 1 << 2)) {
+    return false;
+  }
+  if (settings->use_creases) {
+    if (!add_layer(&mesh->vert_data, CD_PROP_FLOAT, "crease_vert", 1 << 3)) {
+      return false;
+    }
+    if (!add_layer(&mesh->edge_data, CD_PROP_FLOAT, "crease_edge", 1 << 4)) {
+      return false;
+    }
+  }
+  /* Face-varying topology is split based on UV values, so the UV layers are part of the refiner
+   * topology as well. */
+  const int num_uv_layers = CustomData_number_of_layers(&mesh->corner_data, CD_PROP_FLOAT2);
+  for (int i = 0; i < num_uv_layers; i++) {
+    const int index = CustomData_get_layer_index_n(&mesh->corner_data, CD_PROP_FLOAT2, i);
+    const CustomDataLayer &layer = mesh->corner_data.layers[index];
+    if (!add_array(layer.data, layer.sharing_info)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static void topology_identity_release(SubdivTopologyIdentity *identity)
+{
+  for (int i = 0; i < identity->arrays_num; i++) {
+    identity->sharing_infos[i]->remove_user_and_delete_if_last();
+  }
+  identity->arrays_num = 0;
+  identity->is_valid = false;
+}
+
+static void topology_identity_update(Subdiv *subdiv,
+                                     const SubdivSettings *settings,
+                                     const Mesh *mesh)
+{
+  topology_identity_release(&subdiv->topology_identity);
+  SubdivTopologyIdentity identity = {};
+  if (!topology_identity_collect(settings, mesh, &identity)) {
+    return;
+  }
+  for (int i = 0; i < identity.arrays_num; i++) {
+    identity.sharing_infos[i]->add_user();
+  }
+  identity.is_valid = true;
+  subdiv->topology_identity = identity;
+}
+
+static bool topology_identity_match(const Subdiv *subdiv,
+                                    const SubdivSettings *settings,
+                                    const Mesh *mesh)
+{
+  const SubdivTopologyIdentity &identity = subdiv->topology_identity;
+  if (!identity.is_valid) {
+    return false;
+  }
+  if (identity.verts_num != mesh->verts_num || identity.edges_num != mesh->edges_num ||
+      identity.faces_num != mesh->faces_num || identity.corners_num != mesh->corners_num)
+  {
+    return false;
+  }
+  SubdivTopologyIdentity current;
+  if (!topology_identity_collect(settings, mesh, &current)) {
+    return false;
+  }
+  if (current.optional_layers_mask != identity.optional_layers_mask ||
+      current.arrays_num != identity.arrays_num)
+  {
+    return false;
+  }
+  /* The pinned arrays can not have been freed and recycled, so pointer equality of every array
+   * the converter reads proves the topology is unchanged. */
+  return std::equal(current.arrays, current.arrays + current.arrays_num, identity.arrays);
+}
+
 /* --------------------------------------------------------------------
  * Construction.
  */
@@ -133,6 +268,7 @@ Subdiv *BKE_subdiv_new_from_mesh(const SubdivSettings *settings, const Mesh *mes
   BKE_subdiv_converter_init_for_mesh(&converter, settings, mesh);
   Subdiv *subdiv = BKE_subdiv_new_from_converter(settings, &converter);
   BKE_subdiv_converter_free(&converter);
+  topology_identity_update(subdiv, settings, mesh);
   return subdiv;
 }
 
@@ -172,10 +308,22 @@ Subdiv *BKE_subdiv_update_from_mesh(Subdiv *subdiv,
                                     const SubdivSettings *settings,
                                     const Mesh *mesh)
 {
+  /* When the mesh still uses the exact arrays the refiner was built from (the common case for
+   * deform-only animation, where evaluated meshes share topology with the original mesh), the
+   * refiner can be reused without constructing a converter or comparing elements. */
+  if (subdiv != nullptr && subdiv->topology_refiner != nullptr &&
+      BKE_subdiv_settings_equal(&subdiv->settings, settings) &&
+      topology_identity_match(subdiv, settings, mesh))
+  {
+    return subdiv;
+  }
   OpenSubdiv_Converter converter;
   BKE_subdiv_converter_init_for_mesh(&converter, settings, mesh);
   subdiv = BKE_subdiv_update_from_converter(subdiv, settings, &converter);
   BKE_subdiv_converter_free(&converter);
+  if (subdiv != nullptr) {
+    topology_identity_update(subdiv, settings, mesh);
+  }
   return subdiv;
 }
 
@@ -183,6 +331,9 @@ Subdiv *BKE_subdiv_update_from_mesh(Subdiv *subdiv,
 
 void BKE_subdiv_free(Subdiv *subdiv)
 {
+  /* Releasing twice is harmless, which matters when the final free is deferred to the draw code
+   * below. */
+  topology_identity_release(&subdiv->topology_identity);
   if (subdiv->evaluator != nullptr) {
     const eOpenSubdivEvaluator evaluator_type = subdiv->evaluator->type;
     if (evaluator_type != OPENSUBDIV_EVALUATOR_CPU) {
@@ -126,6 +126,18 @@ static int topology_refiner_count_face_corners(OpenSubdiv_TopologyRefiner *topol
 
 /* NOTE: Grid size and layer flags are to be filled in before calling this
  * function. */
+/* NOTE: This densely allocates `grid_area` elements for every grid at the finest level, so a
+ * 6-level multires mesh pays full fine-level memory even where the sculpted displacement is zero
+ * -- on mostly-flat environment pieces that is overwhelmingly storage of zeros (the MDISPS
+ * displacement layer handled by `multires_reshape.cc` has the same dense layout). Because all
+ * access goes through the per-grid `grids[grid_index]` pointers and #CCGKey offsets, the storage
+ * behind them can become sparse at grid granularity without touching callers: element access is
+ * contiguous only within one grid, so each grid can be allocated on first write, with untouched
+ * grids pointing at a shared read-only zero grid (zero displacement means "on the limit
+ * surface", which evaluation already reconstructs). Sculpt write paths would fault a private
+ * copy in where `subdiv_ccg_coord_to_elem` resolves a write target; quadtree-paged storage
+ * within a grid is a further step but changes the element addressing every accessor relies
+ * on. */
 static void subdiv_ccg_alloc_elements(SubdivCCG &subdiv_ccg, Subdiv &subdiv)
 {
   OpenSubdiv_TopologyRefiner *topology_refiner = subdiv.topology_refiner;
@@ -383,6 +383,20 @@ UndoStep *BKE_undosys_stack_init_or_active_with_type(UndoStack *ustack, const Un
   return BKE_undosys_stack_active_with_type(ustack, ut);
 }
 
+/* NOTE: Per-step accounting mostly exists already — every step type fills `us->data_size`,
+ * including sculpt and edit-mode steps — but two things make the walk below coarser than it
+ * looks. Memfile steps share unchanged chunks with their neighbors, so summing `data_size`
+ * over-counts and evicting an old step frees far less than its reported size; honest accounting
+ * needs the chunk refcounts that the de-duplication already maintains. And the only policy is
+ * "free the tail": a cheap, frequently-revisited step (a mode toggle) is evicted as readily as a
+ * 2 GB sculpt stroke.
+ *
+ * The improvement with the best ratio of value to risk is not a policy engine but compression:
+ * once a step is neither first nor last it is immutable until freed, so its payload (memfile
+ * chunks, sculpt node arrays) can be compressed by a background task and decompressed on the
+ * rare step-onto path — undo pressure is about resident bytes, not step count. Any such work
+ * must keep this function the single owner of freeing, and must leave the step list untouched
+ * off-thread; only the payload inside a step may be swapped. */
 void BKE_undosys_stack_limit_steps_and_memory(UndoStack *ustack, int steps, size_t memory_limit)
 {
   UNDO_NESTED_ASSERT(false);
@@ -593,6 +607,15 @@ eUndoPushReturn BKE_undosys_step_push_with_type(UndoStack *ustack,
     ustack->step_active->skip = true;
   }
 
+  if (ustack->memory_policy == UNDO_MEMORY_POLICY_COMPRESS_COLD) {
+    /* The step before the previous one just stopped being needed for fast access (the previous
+     * step stays hot, it is the reference when encoding the next push). */
+    UndoStep *us_cold = ustack->step_active->prev ? ustack->step_active->prev->prev : nullptr;
+    if (us_cold && us_cold->type->step_make_cold) {
+      us_cold->type->step_make_cold(us_cold);
+    }
+  }
+
   undosys_stack_validate(ustack, true);
   return (retval | UNDO_PUSH_RET_SUCCESS);
 }
@@ -445,6 +445,17 @@ bool BKE_volume_set_velocity_grid_by_name(Volume *volume, const char *base_name)
   return false;
 }
 
+/* NOTE: Two of the three ingredients for smooth sequence playback already exist: grids from a
+ * file are shared through the global file cache, and tree data is loaded on demand rather than
+ * with the metadata (see BKE_volume_grid_file_cache.hh). What remains synchronous is the first
+ * touch of each frame's trees, which happens on the depsgraph thread mid-frame and is where the
+ * playback stalls come from. The missing pieces both belong in the file cache, not here:
+ * a prefetcher that, on sequence access, warms the next N frames' trees on background threads in
+ * the current playback direction (this function already resolves the per-frame path, so the
+ * cache has the sequence pattern available); and a byte budget on decoded trees with
+ * furthest-from-playhead eviction, replacing the purely reference-based `unload_unused()`,
+ * which never frees grids a paused viewport still references. The draw cache consumes the same
+ * #GVolumeGrid handles, so budget decisions automatically cover viewport uploads too. */
 bool BKE_volume_load(const Volume *volume, const Main *bmain)
 {
 #ifdef WITH_OPENVDB
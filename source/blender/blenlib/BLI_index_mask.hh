@@ -348,6 +348,11 @@ class IndexMask : private IndexMaskData {
    * between any indices.
    */
   std::optional<IndexRange> to_range() const;
+  /**
+   * True when the mask covers a contiguous range of indices (or is empty). This is O(1), masks
+   * over dense selections are common and kernels can take a contiguous-loop path for them.
+   */
+  bool is_range() const;
   /**
    * \return All index ranges in the mask. In the worst case this is a separate range for every
    * index.
@@ -898,10 +903,55 @@ std::optional<IndexRange> inline IndexMask::to_range() const
   return std::nullopt;
 }
 
+inline bool IndexMask::is_range() const
+{
+  return indices_num_ == 0 || this->last() - this->first() == indices_num_ - 1;
+}
+
+/**
+ * To be used with #call_with_devirtualized_parameters or through
+ * #devirtualize_index_mask. Masks that cover a contiguous range are passed on
+ * as #IndexRange, so kernels get contiguous-loop codegen for dense
+ * selections instead of iterating per-segment index arrays.
+ */
+template<bool UseRange = true> struct IndexMaskDevirtualizer {
+  const IndexMask &mask;
+
+  template<typename Fn> bool devirtualize(const Fn &fn) const
+  {
+    if constexpr (UseRange) {
+      if (const std::optional<IndexRange> range = this->mask.to_range()) {
+        return fn(*range);
+      }
+    }
+    return fn(this->mask);
+  }
+};
+
+/**
+ * Calls \a fn with either an #IndexRange (when the mask is dense) or the mask itself. The
+ * function is instantiated for both cases, so only use this when the contiguous path matters.
+ */
+template<typename Fn> inline void devirtualize_index_mask(const IndexMask &mask, const Fn &fn)
+{
+  IndexMaskDevirtualizer<true>{mask}.devirtualize([&](const auto &mask_or_range) {
+    fn(mask_or_range);
+    return true;
+  });
+}
+
 template<int64_t N>
 inline Vector<std::variant<IndexRange, IndexMaskSegment>, N> IndexMask::to_spans_and_ranges() const
 {
   Vector<std::variant<IndexRange, IndexMaskSegment>, N> segments;
+  /* A dense mask collapses into a single range instead of one entry per segment, so kernels run
+   * one long contiguous loop instead of one per 2^14 indices. */
+  if (const std::optional<IndexRange> range = this->to_range()) {
+    if (!range->is_empty()) {
+      segments.append(*range);
+    }
+    return segments;
+  }
   this->foreach_segment_optimized([&](const auto segment) { segments.append(segment); });
   return segments;
 }
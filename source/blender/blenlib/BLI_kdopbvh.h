@@ -172,6 +172,15 @@ bool BLI_bvhtree_update_node(
  */
 void BLI_bvhtree_update_tree(BVHTree *tree);
 
+/**
+ * How much the bounding volumes degraded since #BLI_bvhtree_balance, as a
+ * factor in [0..1] where 1.0 means as tight as a freshly balanced tree.
+ * Refitting with #BLI_bvhtree_update_tree keeps the topology fixed, so on
+ * strongly deforming geometry the node bounds grow and overlap over time.
+ * Callers can use this to decide when a full rebuild pays off.
+ */
+float BLI_bvhtree_refit_quality(const BVHTree *tree);
+
 /**
  * Use to check the total number of threads #BLI_bvhtree_overlap will use.
  *
@@ -266,6 +275,25 @@ int BLI_bvhtree_ray_cast(const BVHTree *tree,
                          BVHTree_RayCastCallback callback,
                          void *userdata);
 
+/**
+ * Cast many rays in a single traversal, processing them in small packets that
+ * share node visits. Much faster than casting the rays one by one when they
+ * are coherent (similar origins and directions), and never slower: packets
+ * fall apart into per-ray culling as rays diverge.
+ *
+ * \param hits: Array of \a rays_num hits. Each entry must be initialized by
+ * the caller the same way as the hit argument of #BLI_bvhtree_ray_cast
+ * (`index` set to -1, `dist` to the maximum ray length).
+ */
+void BLI_bvhtree_ray_cast_batch(const BVHTree *tree,
+                                const float (*ray_origins)[3],
+                                const float (*ray_directions)[3],
+                                int rays_num,
+                                float radius,
+                                BVHTreeRayHit *hits,
+                                BVHTree_RayCastCallback callback,
+                                void *userdata);
+
 /**
  * Calls the callback for every ray intersection
  *
@@ -267,4 +267,32 @@ template<typename Allocator = GuardedAllocator> class LinearAllocator : NonCopya
   }
 };
 
+/**
+ * Adapter that allows containers like #Map, #Set and #Vector to allocate their storage from a
+ * #LinearAllocator through their `Allocator` template parameter. Deallocation is a no-op, all
+ * memory is freed at once when the linear allocator is destructed. This is useful when many
+ * containers share a lifetime (e.g. one build or evaluation pass): growing containers leak their
+ * old storage into the linear allocator, which is usually far cheaper than the many small
+ * system allocations it replaces.
+ *
+ * The referenced linear allocator must outlive all containers using it.
+ */
+template<typename Allocator = GuardedAllocator> class LinearContainerAllocator {
+ private:
+  LinearAllocator<Allocator> *linear_allocator_;
+
+ public:
+  LinearContainerAllocator(LinearAllocator<Allocator> &linear_allocator)
+      : linear_allocator_(&linear_allocator)
+  {
+  }
+
+  void *allocate(const size_t size, const size_t alignment, const char * /*name*/)
+  {
+    return linear_allocator_->allocate(int64_t(size), int64_t(alignment));
+  }
+
+  void deallocate(void * /*ptr*/) {}
+};
+
 }  // namespace blender
@@ -0,0 +1,179 @@
+/* SPDX-FileCopyrightText: 2023 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#pragma once
+
+/** \file
+ * \ingroup bli
+ *
+ * Batched math kernels that operate on whole spans of vectors at once. The per-element functions
+ * in `BLI_math_vector.hh` are convenient but the surrounding loops often do not vectorize well,
+ * especially when the compiler cannot prove that input and output spans do not alias. The kernels
+ * here process contiguous data with an explicit SIMD fast path (SSE2 natively, NEON through
+ * sse2neon, see `BLI_simd.h`) and a scalar fallback that matches the per-element functions
+ * exactly, including their handling of (nearly) zero length vectors.
+ */
+
+#include "BLI_math_vector.hh"
+#include "BLI_simd.h"
+#include "BLI_span.hh"
+
+namespace blender::math {
+
+namespace simd_detail {
+
+#if BLI_HAVE_SSE2
+
+/**
+ * De-interleave four packed `float3` (12 consecutive floats) into x/y/z registers.
+ */
+inline void load_float3x4(const float *ptr, __m128 &r_x, __m128 &r_y, __m128 &r_z)
+{
+  const __m128 x0y0z0x1 = _mm_loadu_ps(ptr + 0);
+  const __m128 y1z1x2y2 = _mm_loadu_ps(ptr + 4);
+  const __m128 z2x3y3z3 = _mm_loadu_ps(ptr + 8);
+  const __m128 x2y2x3y3 = _mm_shuffle_ps(y1z1x2y2, z2x3y3z3, _MM_SHUFFLE(2, 1, 3, 2));
+  const __m128 y0z0y1z1 = _mm_shuffle_ps(x0y0z0x1, y1z1x2y2, _MM_SHUFFLE(1, 0, 2, 1));
+  r_x = _mm_shuffle_ps(x0y0z0x1, x2y2x3y3, _MM_SHUFFLE(2, 0, 3, 0));
+  r_y = _mm_shuffle_ps(y0z0y1z1, x2y2x3y3, _MM_SHUFFLE(3, 1, 2, 0));
+  r_z = _mm_shuffle_ps(y0z0y1z1, z2x3y3z3, _MM_SHUFFLE(3, 0, 3, 1));
+}
+
+/**
+ * Interleave x/y/z registers back into four packed `float3`.
+ */
+inline void store_float3x4(float *ptr, const __m128 x, const __m128 y, const __m128 z)
+{
+  const __m128 x0x2y0y2 = _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 0, 2, 0));
+  const __m128 y1y3z1z3 = _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 1, 3, 1));
+  const __m128 z0z2x1x3 = _mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 1, 2, 0));
+  _mm_storeu_ps(ptr + 0, _mm_shuffle_ps(x0x2y0y2, z0z2x1x3, _MM_SHUFFLE(2, 0, 2, 0)));
+  _mm_storeu_ps(ptr + 4, _mm_shuffle_ps(y1y3z1z3, x0x2y0y2, _MM_SHUFFLE(3, 1, 2, 0)));
+  _mm_storeu_ps(ptr + 8, _mm_shuffle_ps(z0z2x1x3, y1y3z1z3, _MM_SHUFFLE(3, 1, 3, 1)));
+}
+
+#endif /* BLI_HAVE_SSE2 */
+
+}  // namespace simd_detail
+
+/**
+ * `dst[i] = normalize(src[i])`, with the same behavior as #normalize: vectors whose squared
+ * length is not above the `1e-35f` threshold become zero vectors.
+ *
+ * `src` and `dst` may be the same span for in-place normalization, but must not partially
+ * overlap.
+ */
+inline void normalize_span(const Span<float3> src, MutableSpan<float3> dst)
+{
+  BLI_assert(src.size() == dst.size());
+  const int64_t size = src.size();
+  int64_t i = 0;
+#if BLI_HAVE_SSE2
+  constexpr float threshold = 1.0e-35f;
+  const __m128 threshold4 = _mm_set1_ps(threshold);
+  const __m128 one4 = _mm_set1_ps(1.0f);
+  for (; i + 4 <= size; i += 4) {
+    __m128 x, y, z;
+    simd_detail::load_float3x4(&src[i].x, x, y, z);
+    const __m128 length_sq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)),
+                                        _mm_mul_ps(z, z));
+    /* Division by the exact square root matches the scalar path; `_mm_rsqrt_ps` is not precise
+     * enough for normals. The mask zeroes degenerate vectors like #normalize does. */
+    const __m128 valid = _mm_cmpgt_ps(length_sq, threshold4);
+    const __m128 inv_length = _mm_and_ps(_mm_div_ps(one4, _mm_sqrt_ps(length_sq)), valid);
+    simd_detail::store_float3x4(
+        &dst[i].x, _mm_mul_ps(x, inv_length), _mm_mul_ps(y, inv_length), _mm_mul_ps(z, inv_length));
+  }
+#endif
+  for (; i < size; i++) {
+    dst[i] = math::normalize(src[i]);
+  }
+}
+
+/**
+ * Normalize all vectors in place, see the copying overload above.
+ */
+inline void normalize_span(MutableSpan<float3> vectors)
+{
+  normalize_span(vectors.as_span(), vectors);
+}
+
+/**
+ * `r_dots[i] = dot(a[i], b[i])`.
+ */
+inline void dot_span(const Span<float3> a, const Span<float3> b, MutableSpan<float> r_dots)
+{
+  BLI_assert(a.size() == b.size());
+  BLI_assert(a.size() == r_dots.size());
+  const int64_t size = a.size();
+  int64_t i = 0;
+#if BLI_HAVE_SSE2
+  for (; i + 4 <= size; i += 4) {
+    __m128 ax, ay, az, bx, by, bz;
+    simd_detail::load_float3x4(&a[i].x, ax, ay, az);
+    simd_detail::load_float3x4(&b[i].x, bx, by, bz);
+    _mm_storeu_ps(&r_dots[i],
+                  _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax, bx), _mm_mul_ps(ay, by)),
+                             _mm_mul_ps(az, bz)));
+  }
+#endif
+  for (; i < size; i++) {
+    r_dots[i] = math::dot(a[i], b[i]);
+  }
+}
+
+/**
+ * `r_crosses[i] = cross(a[i], b[i])`.
+ */
+inline void cross_span(const Span<float3> a, const Span<float3> b, MutableSpan<float3> r_crosses)
+{
+  BLI_assert(a.size() == b.size());
+  BLI_assert(a.size() == r_crosses.size());
+  const int64_t size = a.size();
+  int64_t i = 0;
+#if BLI_HAVE_SSE2
+  for (; i + 4 <= size; i += 4) {
+    __m128 ax, ay, az, bx, by, bz;
+    simd_detail::load_float3x4(&a[i].x, ax, ay, az);
+    simd_detail::load_float3x4(&b[i].x, bx, by, bz);
+    simd_detail::store_float3x4(&r_crosses[i].x,
+                                _mm_sub_ps(_mm_mul_ps(ay, bz), _mm_mul_ps(az, by)),
+                                _mm_sub_ps(_mm_mul_ps(az, bx), _mm_mul_ps(ax, bz)),
+                                _mm_sub_ps(_mm_mul_ps(ax, by), _mm_mul_ps(ay, bx)));
+  }
+#endif
+  for (; i < size; i++) {
+    r_crosses[i] = math::cross(a[i], b[i]);
+  }
+}
+
+/**
+ * `r_accumulated[i] += vectors[i] * factors[i]`.
+ */
+inline void madd_span(const Span<float3> vectors,
+                      const Span<float> factors,
+                      MutableSpan<float3> r_accumulated)
+{
+  BLI_assert(vectors.size() == factors.size());
+  BLI_assert(vectors.size() == r_accumulated.size());
+  const int64_t size = vectors.size();
+  int64_t i = 0;
+#if BLI_HAVE_SSE2
+  for (; i + 4 <= size; i += 4) {
+    __m128 vx, vy, vz, ax, ay, az;
+    simd_detail::load_float3x4(&vectors[i].x, vx, vy, vz);
+    simd_detail::load_float3x4(&r_accumulated[i].x, ax, ay, az);
+    const __m128 factor = _mm_loadu_ps(&factors[i]);
+    simd_detail::store_float3x4(&r_accumulated[i].x,
+                                _mm_add_ps(ax, _mm_mul_ps(vx, factor)),
+                                _mm_add_ps(ay, _mm_mul_ps(vy, factor)),
+                                _mm_add_ps(az, _mm_mul_ps(vz, factor)));
+  }
+#endif
+  for (; i < size; i++) {
+    r_accumulated[i] += vectors[i] * factors[i];
+  }
+}
+
+}  // namespace blender::math
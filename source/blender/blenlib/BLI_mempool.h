@@ -50,6 +50,13 @@ void BLI_mempool_clear(BLI_mempool *pool) ATTR_NONNULL(1);
  * Free the mempool itself (and all elements).
  */
 void BLI_mempool_destroy(BLI_mempool *pool) ATTR_NONNULL(1);
+/**
+ * Move all chunks and elements of \a pool_src into \a pool_dst and free the
+ * source pool. Both pools must have been created with the same element size,
+ * chunk size and flags. Elements keep their addresses, iteration visits the
+ * destination elements first.
+ */
+void BLI_mempool_merge(BLI_mempool *pool_dst, BLI_mempool *pool_src) ATTR_NONNULL(1, 2);
 int BLI_mempool_len(const BLI_mempool *pool) ATTR_NONNULL(1);
 void *BLI_mempool_findelem(BLI_mempool *pool, unsigned int index) ATTR_WARN_UNUSED_RESULT
     ATTR_NONNULL(1);
@@ -118,6 +125,35 @@ void BLI_mempool_iternew(BLI_mempool *pool, BLI_mempool_iter *iter) ATTR_NONNULL
  */
 void *BLI_mempool_iterstep(BLI_mempool_iter *iter) ATTR_WARN_UNUSED_RESULT ATTR_NONNULL();
 
+/**
+ * Sharded pool for concurrent allocation without locks: every shard is a
+ * regular #BLI_mempool that a single thread fills through
+ * #BLI_sharded_mempool_shard (use the thread/task index as shard index).
+ * Afterwards #BLI_sharded_mempool_merge folds the shards into one pool that
+ * behaves as if it was filled serially, so existing single-threaded code
+ * (iteration, lookups, freeing) keeps working unchanged.
+ */
+typedef struct BLI_sharded_mempool BLI_sharded_mempool;
+
+BLI_sharded_mempool *BLI_sharded_mempool_create(unsigned int esize,
+                                                unsigned int elem_num,
+                                                unsigned int pchunk,
+                                                unsigned int flag,
+                                                unsigned int shards_num)
+    ATTR_MALLOC ATTR_WARN_UNUSED_RESULT ATTR_RETURNS_NONNULL;
+/**
+ * Access the pool of a single shard. Only one thread may allocate from a
+ * given shard at any time, different shards are safe to use concurrently.
+ */
+BLI_mempool *BLI_sharded_mempool_shard(BLI_sharded_mempool *pool, unsigned int shard)
+    ATTR_WARN_UNUSED_RESULT ATTR_NONNULL(1);
+/**
+ * Merge all shards into a single pool (see #BLI_mempool_merge) and free the
+ * sharded pool itself. The returned pool is owned by the caller.
+ */
+BLI_mempool *BLI_sharded_mempool_merge(BLI_sharded_mempool *pool)
+    ATTR_WARN_UNUSED_RESULT ATTR_NONNULL(1);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,81 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#pragma once
+
+/** \file
+ * \ingroup bli
+ *
+ * Low overhead instrumentation for diagnosing production slowdowns without rebuilding.
+ *
+ * Unlike #BLI_timeit.hh, which prints to stdout and is meant to be added temporarily while
+ * developing, these scopes are intended to stay in hot paths permanently: when profiling is not
+ * enabled a scope costs a single branch on a global flag, and when it is enabled each event is
+ * two clock reads and an append to a pre-allocated per-thread buffer, with no locking.
+ *
+ * Recording is enabled with the `--profile-trace <file>` command line argument. On process exit
+ * the collected events from all threads are written to the given file in the Chrome trace format,
+ * which can be opened in `chrome://tracing` or https://ui.perfetto.dev.
+ *
+ * \warning Event names and categories are stored as pointers and read back only when the trace is
+ * written at exit, so both must point to memory that outlives all scene data: string literals or
+ * static data such as #ModifierTypeInfo.name. Never pass a name owned by an ID or a depsgraph.
+ */
+
+#include <cstdint>
+
+namespace blender::profile {
+
+/**
+ * Start recording and register writing the trace file on process exit.
+ * Must be called from the main thread before other threads start recording (in practice: during
+ * argument parsing). Only the first call has an effect.
+ */
+void enable(const char *filepath);
+
+/** Stop recording, write the trace file and free all event buffers. */
+void disable_and_write();
+
+namespace detail {
+
+/** Read in every scope constructor; written only by #enable / #disable_and_write. */
+extern bool g_enabled;
+
+uint64_t clock_now_ns();
+void add_event(const char *name, const char *category, uint64_t begin_ns, uint64_t end_ns);
+
+}  // namespace detail
+
+class ProfileScope {
+ private:
+  const char *name_;
+  const char *category_;
+  uint64_t begin_ns_;
+  bool active_;
+
+ public:
+  ProfileScope(const char *name, const char *category) : name_(name), category_(category)
+  {
+    active_ = detail::g_enabled;
+    if (active_) {
+      begin_ns_ = detail::clock_now_ns();
+    }
+  }
+
+  ~ProfileScope()
+  {
+    if (active_) {
+      detail::add_event(name_, category_, begin_ns_, detail::clock_now_ns());
+    }
+  }
+};
+
+}  // namespace blender::profile
+
+/**
+ * Record the enclosing scope as one event. \a name and \a category must have static storage
+ * duration, see the warning in the file documentation.
+ */
+#define BLI_PROFILE_SCOPE(name, category) \
+  blender::profile::ProfileScope profile_scope(name, category)
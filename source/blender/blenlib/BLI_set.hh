@@ -690,7 +690,8 @@ class Set {
     }
 
     /* The grown array that we insert the keys into. */
-    SlotArray new_slots(total_slots);
+    /* Use the existing allocator, so stateful allocators propagate on growth. */
+    SlotArray new_slots(total_slots, slots_.allocator());
 
     try {
       for (Slot &slot : slots_) {
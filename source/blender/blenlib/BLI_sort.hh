@@ -8,12 +8,19 @@
  * \ingroup bli
  */
 
+#include <cstring>
+#include <type_traits>
+
 #ifdef WITH_TBB
 #  include <tbb/parallel_sort.h>
 #else
 #  include <algorithm>
 #endif
 
+#include "BLI_array.hh"
+#include "BLI_span.hh"
+#include "BLI_task.hh"
+
 namespace blender {
 
 #ifdef WITH_TBB
@@ -31,4 +38,159 @@ void parallel_sort(RandomAccessIterator begin, RandomAccessIterator end, const C
 }
 #endif
 
+namespace sort_detail {
+
+/**
+ * Map values to unsigned keys whose unsigned order matches the value order,
+ * so a radix sort on the keys sorts the values.
+ */
+inline uint32_t radix_key(const uint32_t value)
+{
+  return value;
+}
+inline uint32_t radix_key(const int32_t value)
+{
+  return uint32_t(value) ^ (uint32_t(1) << 31);
+}
+inline uint64_t radix_key(const uint64_t value)
+{
+  return value;
+}
+inline uint64_t radix_key(const int64_t value)
+{
+  return uint64_t(value) ^ (uint64_t(1) << 63);
+}
+/* Flip the sign bit for positive floats and all bits for negative ones.
+ * NaNs end up past infinity, matching that comparison sorts don't support
+ * them in a meaningful way either. */
+inline uint32_t radix_key(const float value)
+{
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  return bits ^ (uint32_t(int32_t(bits) >> 31) | (uint32_t(1) << 31));
+}
+
+template<typename T>
+inline constexpr bool is_radix_sortable_v = std::is_same_v<T, int32_t> ||
+                                            std::is_same_v<T, uint32_t> ||
+                                            std::is_same_v<T, int64_t> ||
+                                            std::is_same_v<T, uint64_t> ||
+                                            std::is_same_v<T, float>;
+
+/* Below this size the counting passes and the temporary buffer don't pay off
+ * compared to a comparison sort. */
+inline constexpr int64_t radix_sort_min_size = 1 << 14;
+
+/**
+ * Parallel LSD radix sort on 8 bit digits. The values are processed in
+ * chunks: every chunk owns a histogram row, so both the counting and the
+ * stable scatter parallelize without atomics; only the exclusive scan over
+ * the rows is serial, which is negligible (256 entries per chunk). Passes
+ * where all keys share the same digit are skipped.
+ */
+template<typename T> void parallel_radix_sort(MutableSpan<T> values)
+{
+  using KeyT = decltype(radix_key(std::declval<T>()));
+  constexpr int digit_bits = 8;
+  constexpr int buckets_num = 1 << digit_bits;
+  constexpr int passes_num = sizeof(KeyT) * 8 / digit_bits;
+  constexpr int64_t chunk_size = 1 << 16;
+
+  const int64_t size = values.size();
+  const int64_t chunks_num = (size + chunk_size - 1) / chunk_size;
+
+  Array<T> temp(size);
+  MutableSpan<T> src = values;
+  MutableSpan<T> dst = temp;
+
+  Array<int64_t> histograms(chunks_num * buckets_num);
+
+  for (int pass = 0; pass < passes_num; pass++) {
+    const int shift = pass * digit_bits;
+
+    threading::parallel_for(IndexRange(chunks_num), 1, [&](const IndexRange range) {
+      for (const int64_t chunk : range) {
+        MutableSpan<int64_t> histogram = histograms.as_mutable_span().slice(
+            chunk * buckets_num, buckets_num);
+        histogram.fill(0);
+        for (const T &value : src.slice(chunk * chunk_size,
+                                        std::min(chunk_size, size - chunk * chunk_size)))
+        {
+          histogram[(radix_key(value) >> shift) & (buckets_num - 1)]++;
+        }
+      }
+    });
+
+    /* Exclusive scan in bucket-major order so the scatter stays stable. */
+    int64_t offset = 0;
+    bool single_bucket = false;
+    for (int64_t bucket = 0; bucket < buckets_num; bucket++) {
+      int64_t bucket_total = 0;
+      for (int64_t chunk = 0; chunk < chunks_num; chunk++) {
+        int64_t &count = histograms[chunk * buckets_num + bucket];
+        bucket_total += count;
+        const int64_t count_temp = count;
+        count = offset;
+        offset += count_temp;
+      }
+      if (bucket_total == size) {
+        single_bucket = true;
+        break;
+      }
+    }
+    if (single_bucket) {
+      /* All keys share this digit, nothing to move. */
+      continue;
+    }
+
+    threading::parallel_for(IndexRange(chunks_num), 1, [&](const IndexRange range) {
+      for (const int64_t chunk : range) {
+        MutableSpan<int64_t> offsets = histograms.as_mutable_span().slice(chunk * buckets_num,
+                                                                          buckets_num);
+        for (const T &value : src.slice(chunk * chunk_size,
+                                        std::min(chunk_size, size - chunk * chunk_size)))
+        {
+          dst[offsets[(radix_key(value) >> shift) & (buckets_num - 1)]++] = value;
+        }
+      }
+    });
+
+    std::swap(src, dst);
+  }
+
+  if (src.data() != values.data()) {
+    /* An odd number of executed passes leaves the result in the temporary
+     * buffer (only possible when digit passes were skipped). */
+    values.copy_from(src);
+  }
+}
+
+}  // namespace sort_detail
+
+/**
+ * Sort the span in ascending order using multiple threads. Integer and float
+ * spans take a parallel radix sort path when large enough, other types fall
+ * back to comparison based #parallel_sort. Not stable for equal-comparing but
+ * distinguishable values.
+ */
+template<typename T> inline void parallel_sort(MutableSpan<T> values)
+{
+  if constexpr (sort_detail::is_radix_sortable_v<T>) {
+    if (values.size() >= sort_detail::radix_sort_min_size) {
+      sort_detail::parallel_radix_sort(values);
+      return;
+    }
+  }
+  parallel_sort(values.begin(), values.end());
+}
+
+/**
+ * Sort the span with a custom comparator using multiple threads.
+ */
+template<typename T, typename Compare>
+inline void parallel_sort(MutableSpan<T> values, const Compare &comp)
+{
+  parallel_sort(values.begin(), values.end(), comp);
+}
+
 }  // namespace blender
@@ -35,6 +35,7 @@
 #include "BLI_function_ref.hh"
 #include "BLI_index_range.hh"
 #include "BLI_lazy_threading.hh"
+#include "BLI_span.hh"
 #include "BLI_utildefines.h"
 
 namespace blender {
@@ -68,6 +69,10 @@ namespace detail {
 void parallel_for_impl(IndexRange range,
                        int64_t grain_size,
                        FunctionRef<void(IndexRange)> function);
+void parallel_for_weighted_impl(IndexRange range,
+                                int64_t grain_size,
+                                FunctionRef<void(IndexRange)> function,
+                                FunctionRef<void(IndexRange, MutableSpan<int64_t>)> task_sizes_fn);
 }  // namespace detail
 
 template<typename Function>
@@ -124,6 +129,33 @@ inline void parallel_for_aligned(const IndexRange range,
   });
 }
 
+/**
+ * Same as #parallel_for, but the caller provides the approximate amount of work for every index.
+ * Tasks are cut so that each contains approximately #grain_size accumulated work rather than a
+ * fixed number of indices. This distributes work between threads more evenly when the work per
+ * index varies a lot, e.g. when iterating over curves with very different point counts, and avoids
+ * scheduling many tiny tasks when most elements are small.
+ *
+ * \param task_size_fn: Returns the approximate size of the work for an index. Must not be
+ * negative.
+ */
+template<typename Function, typename TaskSizeFn>
+inline void parallel_for_weighted(const IndexRange range,
+                                  const int64_t grain_size,
+                                  const Function &function,
+                                  const TaskSizeFn &task_size_fn)
+{
+  if (range.is_empty()) {
+    return;
+  }
+  detail::parallel_for_weighted_impl(
+      range, grain_size, function, [&](const IndexRange sub_range, MutableSpan<int64_t> r_sizes) {
+        for (const int64_t i : sub_range.index_range()) {
+          r_sizes[i] = int64_t(task_size_fn(sub_range[i]));
+        }
+      });
+}
+
 template<typename Value, typename Function, typename Reduction>
 inline Value parallel_reduce(IndexRange range,
                              int64_t grain_size,
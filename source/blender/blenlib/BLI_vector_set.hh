@@ -610,7 +610,8 @@ class VectorSet {
       return;
     }
 
-    SlotArray new_slots(total_slots);
+    /* Use the existing allocator, so stateful allocators propagate on growth. */
+    SlotArray new_slots(total_slots, slots_.allocator());
 
     try {
       for (Slot &slot : slots_) {
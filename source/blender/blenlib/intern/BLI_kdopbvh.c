@@ -82,14 +82,15 @@ struct BVHTree {
   float epsilon;       /* Epsilon is used for inflation of the K-DOP. */
   int leaf_num;        /* leafs */
   int branch_num;
+  float balance_area;  /* Sum of branch bounds areas right after balancing, see refit quality. */
   axis_t start_axis, stop_axis; /* bvhtree_kdop_axes array indices according to axis */
   axis_t axis;                  /* KDOP type (6 => OBB, 7 => AABB, ...) */
   char tree_type;               /* type of tree (4 => quad-tree). */
 };
 
 /* optimization, ensure we stay small */
-BLI_STATIC_ASSERT((sizeof(void *) == 8 && sizeof(BVHTree) <= 48) ||
-                      (sizeof(void *) == 4 && sizeof(BVHTree) <= 32),
+BLI_STATIC_ASSERT((sizeof(void *) == 8 && sizeof(BVHTree) <= 56) ||
+                      (sizeof(void *) == 4 && sizeof(BVHTree) <= 36),
                   "over sized")
 
 /* avoid duplicating vars in BVHOverlapData_Thread */
@@ -943,6 +944,26 @@ void BLI_bvhtree_free(BVHTree *tree)
   }
 }
 
+/**
+ * Sum of the surface areas of all branch bounding volumes, measured on the
+ * three main axes. Grows as refitting inflates the bounds, which makes it a
+ * cheap proxy for how much traversal quality degraded since balancing.
+ */
+static float bvhtree_branch_area_sum(const BVHTree *tree)
+{
+  float area = 0.0f;
+
+  for (int i = 0; i < tree->branch_num; i++) {
+    const float *bv = tree->nodes[tree->leaf_num + i]->bv;
+    const float dx = bv[1] - bv[0];
+    const float dy = bv[3] - bv[2];
+    const float dz = bv[5] - bv[4];
+    area += dx * dy + dy * dz + dz * dx;
+  }
+
+  return area;
+}
+
 void BLI_bvhtree_balance(BVHTree *tree)
 {
   BVHNode **leafs_array = tree->nodes;
@@ -962,6 +983,8 @@ void BLI_bvhtree_balance(BVHTree *tree)
     tree->nodes[tree->leaf_num + i] = &tree->nodearray[tree->leaf_num + i];
   }
 
+  tree->balance_area = bvhtree_branch_area_sum(tree);
+
 #ifdef USE_SKIP_LINKS
   build_skip_links(tree, tree->nodes[tree->leaf_num], NULL, NULL);
 #endif
@@ -1040,6 +1063,19 @@ void BLI_bvhtree_update_tree(BVHTree *tree)
     node_join(tree, *index);
   }
 }
+float BLI_bvhtree_refit_quality(const BVHTree *tree)
+{
+  if (tree->branch_num == 0 || tree->balance_area <= FLT_EPSILON) {
+    return 1.0f;
+  }
+
+  const float area = bvhtree_branch_area_sum(tree);
+  if (area <= tree->balance_area) {
+    return 1.0f;
+  }
+  return tree->balance_area / area;
+}
+
 int BLI_bvhtree_get_len(const BVHTree *tree)
 {
   return tree->leaf_num;
@@ -2041,6 +2077,118 @@ int BLI_bvhtree_ray_cast(const BVHTree *tree,
       tree, co, dir, radius, hit, callback, userdata, BVH_RAYCAST_DEFAULT);
 }
 
+/* Number of rays traversed together by #BLI_bvhtree_ray_cast_batch.
+ * Chosen so the per-ray slab tests fit a 128 bit SIMD register when the
+ * compiler vectorizes the inner loops. */
+#define BVH_RAYCAST_PACKET_SIZE 4
+
+/**
+ * Traverse the tree once for a packet of rays. Every node is tested against
+ * all rays that are still active; rays whose entry distance exceeds their
+ * current hit distance are culled from the packet passed to the children, so
+ * diverging rays degrade gracefully to single-ray traversal.
+ */
+static void dfs_raycast_packet(BVHRayCastData **packet, const int packet_num, BVHNode *node)
+{
+  BVHRayCastData *active[BVH_RAYCAST_PACKET_SIZE];
+  float active_dist[BVH_RAYCAST_PACKET_SIZE];
+  int active_num = 0;
+  int i;
+
+  for (i = 0; i < packet_num; i++) {
+    BVHRayCastData *data = packet[i];
+    /* XXX: temporary solution for particles until fast_ray_nearest_hit supports ray.radius */
+    const float dist = (data->ray.radius == 0.0f) ? fast_ray_nearest_hit(data, node) :
+                                                    ray_nearest_hit(data, node->bv);
+    if (dist < data->hit.dist) {
+      active_dist[active_num] = dist;
+      active[active_num++] = data;
+    }
+  }
+
+  if (active_num == 0) {
+    return;
+  }
+
+  if (node->node_num == 0) {
+    for (i = 0; i < active_num; i++) {
+      BVHRayCastData *data = active[i];
+      if (data->callback) {
+        data->callback(data->userdata, node->index, &data->ray, &data->hit);
+      }
+      else {
+        data->hit.index = node->index;
+        data->hit.dist = active_dist[i];
+        madd_v3_v3v3fl(data->hit.co, data->ray.origin, data->ray.direction, active_dist[i]);
+      }
+    }
+  }
+  else {
+    /* Pick the loop direction from the first active ray, for coherent
+     * packets all rays agree on the sign along the split axis anyway. */
+    if (active[0]->ray_dot_axis[node->main_axis] > 0.0f) {
+      for (i = 0; i != node->node_num; i++) {
+        dfs_raycast_packet(active, active_num, node->children[i]);
+      }
+    }
+    else {
+      for (i = node->node_num - 1; i >= 0; i--) {
+        dfs_raycast_packet(active, active_num, node->children[i]);
+      }
+    }
+  }
+}
+
+void BLI_bvhtree_ray_cast_batch(const BVHTree *tree,
+                                const float (*ray_origins)[3],
+                                const float (*ray_directions)[3],
+                                const int rays_num,
+                                const float radius,
+                                BVHTreeRayHit *hits,
+                                BVHTree_RayCastCallback callback,
+                                void *userdata)
+{
+  BVHNode *root = tree->nodes[tree->leaf_num];
+  int packet_start;
+
+  if (root == NULL) {
+    return;
+  }
+
+  for (packet_start = 0; packet_start < rays_num; packet_start += BVH_RAYCAST_PACKET_SIZE) {
+    BVHRayCastData data[BVH_RAYCAST_PACKET_SIZE];
+    BVHRayCastData *packet[BVH_RAYCAST_PACKET_SIZE];
+    const int packet_num = MIN2(rays_num - packet_start, BVH_RAYCAST_PACKET_SIZE);
+    int i;
+
+    for (i = 0; i < packet_num; i++) {
+      const int ray_index = packet_start + i;
+
+      BLI_ASSERT_UNIT_V3(ray_directions[ray_index]);
+
+      data[i].tree = tree;
+      data[i].callback = callback;
+      data[i].userdata = userdata;
+
+      copy_v3_v3(data[i].ray.origin, ray_origins[ray_index]);
+      copy_v3_v3(data[i].ray.direction, ray_directions[ray_index]);
+      data[i].ray.radius = radius;
+
+      bvhtree_ray_cast_data_precalc(&data[i], BVH_RAYCAST_DEFAULT);
+
+      memcpy(&data[i].hit, &hits[ray_index], sizeof(data[i].hit));
+
+      packet[i] = &data[i];
+    }
+
+    dfs_raycast_packet(packet, packet_num, root);
+
+    for (i = 0; i < packet_num; i++) {
+      memcpy(&hits[packet_start + i], &data[i].hit, sizeof(data[i].hit));
+    }
+  }
+}
+
 float BLI_bvhtree_bb_raycast(const float bv[6],
                              const float light_start[3],
                              const float light_end[3],
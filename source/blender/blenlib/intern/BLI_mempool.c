@@ -918,6 +918,108 @@ void BLI_mempool_destroy(BLI_mempool *pool)
   MEM_freeN(pool);
 }
 
+void BLI_mempool_merge(BLI_mempool *pool_dst, BLI_mempool *pool_src)
+{
+  BLI_assert(pool_dst->esize == pool_src->esize);
+  BLI_assert(pool_dst->pchunk == pool_src->pchunk);
+  BLI_assert(pool_dst->flag == pool_src->flag);
+
+  mempool_asan_lock(pool_dst);
+  mempool_asan_lock(pool_src);
+
+  /* Append the source chunks so iteration order stays append-order. */
+  if (pool_src->chunks) {
+    if (pool_dst->chunks) {
+      pool_dst->chunk_tail->next = pool_src->chunks;
+    }
+    else {
+      pool_dst->chunks = pool_src->chunks;
+    }
+    pool_dst->chunk_tail = pool_src->chunk_tail;
+  }
+
+  /* Splice the source free-list in front of the destination one. */
+  if (pool_src->free) {
+    BLI_freenode *free_tail = pool_src->free;
+    while (free_tail->next) {
+      free_tail = free_tail->next;
+    }
+    free_tail->next = pool_dst->free;
+    pool_dst->free = pool_src->free;
+  }
+
+  pool_dst->totused += pool_src->totused;
+  pool_dst->maxchunks += pool_src->maxchunks;
+#ifdef USE_TOTALLOC
+  pool_dst->totalloc += pool_src->totalloc;
+#endif
+
+  mempool_asan_unlock(pool_src);
+  mempool_asan_unlock(pool_dst);
+
+#ifdef WITH_MEM_VALGRIND
+  /* Transfer the element tracking, the source anchor is gone after this. */
+  VALGRIND_MOVE_MEMPOOL(pool_src, pool_dst);
+#endif
+
+  MEM_freeN(pool_src);
+}
+
+/* -------------------------------------------------------------------- */
+/** \name Sharded Pool
+ *
+ * Thread-safe allocation by sharding: every shard is a regular #BLI_mempool
+ * that only one thread may use at a time (typically the thread matching the
+ * shard index), so no locks or atomics are needed on the allocation path.
+ * Once the parallel phase is over the shards merge into a single pool that
+ * behaves as if it was filled serially.
+ * \{ */
+
+struct BLI_sharded_mempool {
+  BLI_mempool **shards;
+  uint shards_num;
+};
+
+BLI_sharded_mempool *BLI_sharded_mempool_create(
+    uint esize, uint elem_num, uint pchunk, uint flag, uint shards_num)
+{
+  BLI_sharded_mempool *pool = MEM_mallocN(sizeof(*pool), "sharded mempool");
+
+  BLI_assert(shards_num > 0);
+
+  pool->shards = MEM_mallocN(sizeof(*pool->shards) * (size_t)shards_num,
+                             "sharded mempool shards");
+  pool->shards_num = shards_num;
+  for (uint i = 0; i < shards_num; i++) {
+    /* Spread the reserve over the shards. */
+    pool->shards[i] = BLI_mempool_create(esize, elem_num / shards_num, pchunk, flag);
+  }
+
+  return pool;
+}
+
+BLI_mempool *BLI_sharded_mempool_shard(BLI_sharded_mempool *pool, uint shard)
+{
+  BLI_assert(shard < pool->shards_num);
+  return pool->shards[shard];
+}
+
+BLI_mempool *BLI_sharded_mempool_merge(BLI_sharded_mempool *pool)
+{
+  BLI_mempool *pool_merged = pool->shards[0];
+
+  for (uint i = 1; i < pool->shards_num; i++) {
+    BLI_mempool_merge(pool_merged, pool->shards[i]);
+  }
+
+  MEM_freeN(pool->shards);
+  MEM_freeN(pool);
+
+  return pool_merged;
+}
+
+/** \} */
+
 #ifndef NDEBUG
 void BLI_mempool_set_memory_debug(void)
 {
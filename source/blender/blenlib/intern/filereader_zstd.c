@@ -13,9 +13,22 @@
 #include "BLI_endian_switch.h"
 #include "BLI_filereader.h"
 #include "BLI_math_base.h"
+#include "BLI_task.h"
 
 #include "MEM_guardedalloc.h"
 
+/** Number of frames that are decompressed ahead of the read position (seekable files only). */
+#define ZSTD_PREFETCH_NUM 4
+
+typedef struct {
+  int frame;
+  char *compressed;
+  size_t compressed_size;
+  char *uncompressed;
+  size_t uncompressed_size;
+  ZSTD_DCtx *ctx;
+} ZstdPrefetchSlot;
+
 typedef struct {
   FileReader reader;
 
@@ -32,6 +45,12 @@ typedef struct {
 
     char *cached_content;
     int cached_frame;
+
+    /* Read-ahead: upcoming frames are decompressed on a task pool while the caller processes
+     * the current one, so sequential reads don't serialize on decompression. */
+    TaskPool *prefetch_pool;
+    ZstdPrefetchSlot prefetch_slots[ZSTD_PREFETCH_NUM];
+    bool prefetch_in_flight;
   } seek;
 } ZstdReader;
 
@@ -128,6 +147,9 @@ static bool zstd_read_seek_table(ZstdReader *zstd)
   }
 
   zstd->seek.cached_frame = -1;
+  for (int i = 0; i < ZSTD_PREFETCH_NUM; i++) {
+    zstd->seek.prefetch_slots[i].frame = -1;
+  }
 
   return true;
 }
@@ -155,6 +177,82 @@ static int zstd_frame_from_pos(ZstdReader *zstd, size_t pos)
   return low;
 }
 
+/* Decompress one prefetched frame. Runs on the task pool, so it only touches its own slot. */
+static void zstd_prefetch_task(TaskPool *__restrict UNUSED(pool), void *taskdata)
+{
+  ZstdPrefetchSlot *slot = taskdata;
+
+  slot->uncompressed = MEM_mallocN(slot->uncompressed_size, __func__);
+  size_t res = ZSTD_decompressDCtx(slot->ctx,
+                                   slot->uncompressed,
+                                   slot->uncompressed_size,
+                                   slot->compressed,
+                                   slot->compressed_size);
+  MEM_SAFE_FREE(slot->compressed);
+  if (ZSTD_isError(res) || res < slot->uncompressed_size) {
+    /* Errors are not fatal here, the frame is just decompressed again synchronously (and the
+     * error reported) when the read position actually reaches it. */
+    MEM_SAFE_FREE(slot->uncompressed);
+    slot->frame = -1;
+  }
+}
+
+static void zstd_prefetch_wait(ZstdReader *zstd)
+{
+  if (zstd->seek.prefetch_in_flight) {
+    BLI_task_pool_work_and_wait(zstd->seek.prefetch_pool);
+    zstd->seek.prefetch_in_flight = false;
+  }
+}
+
+/* Queue decompression of the frames following `frame`, assuming mostly sequential reads.
+ * The compressed data is read from the base reader here (it is not thread-safe), only the
+ * decompression itself runs on the task pool. */
+static void zstd_prefetch_start(ZstdReader *zstd, int frame)
+{
+  BLI_assert(!zstd->seek.prefetch_in_flight);
+
+  if (zstd->seek.prefetch_pool == NULL) {
+    zstd->seek.prefetch_pool = BLI_task_pool_create(zstd, TASK_PRIORITY_HIGH);
+  }
+
+  for (int i = 0; i < ZSTD_PREFETCH_NUM; i++) {
+    const int slot_frame = frame + 1 + i;
+    /* Index the ring by frame number so a frame keeps its slot across calls: on a sequential
+     * advance the slots for the frames that are still ahead match below and only the one
+     * newly-entered frame is read and queued. */
+    ZstdPrefetchSlot *slot = &zstd->seek.prefetch_slots[slot_frame % ZSTD_PREFETCH_NUM];
+    if (slot->frame == slot_frame && slot->uncompressed) {
+      /* Still valid from an earlier prefetch. */
+      continue;
+    }
+    MEM_SAFE_FREE(slot->uncompressed);
+    slot->frame = -1;
+    if (slot_frame >= zstd->seek.frames_num) {
+      continue;
+    }
+
+    slot->compressed_size = zstd->seek.compressed_ofs[slot_frame + 1] -
+                            zstd->seek.compressed_ofs[slot_frame];
+    slot->uncompressed_size = zstd->seek.uncompressed_ofs[slot_frame + 1] -
+                              zstd->seek.uncompressed_ofs[slot_frame];
+    slot->compressed = MEM_mallocN(slot->compressed_size, __func__);
+    if (zstd->base->seek(zstd->base, zstd->seek.compressed_ofs[slot_frame], SEEK_SET) < 0 ||
+        zstd->base->read(zstd->base, slot->compressed, slot->compressed_size) <
+            slot->compressed_size)
+    {
+      MEM_SAFE_FREE(slot->compressed);
+      continue;
+    }
+    if (slot->ctx == NULL) {
+      slot->ctx = ZSTD_createDCtx();
+    }
+    slot->frame = slot_frame;
+    BLI_task_pool_push(zstd->seek.prefetch_pool, zstd_prefetch_task, slot, false, NULL);
+    zstd->seek.prefetch_in_flight = true;
+  }
+}
+
 /* Ensure that the currently loaded frame is the correct one. */
 static const char *zstd_ensure_cache(ZstdReader *zstd, int frame)
 {
@@ -165,31 +263,52 @@ static const char *zstd_ensure_cache(ZstdReader *zstd, int frame)
 
   /* Cached frame doesn't match, so discard it and cache the wanted one instead. */
   MEM_SAFE_FREE(zstd->seek.cached_content);
+  zstd->seek.cached_frame = -1;
 
-  size_t compressed_size = zstd->seek.compressed_ofs[frame + 1] - zstd->seek.compressed_ofs[frame];
-  size_t uncompressed_size = zstd->seek.uncompressed_ofs[frame + 1] -
-                             zstd->seek.uncompressed_ofs[frame];
+  zstd_prefetch_wait(zstd);
 
-  char *uncompressed_data = MEM_mallocN(uncompressed_size, __func__);
-  char *compressed_data = MEM_mallocN(compressed_size, __func__);
-  if (zstd->base->seek(zstd->base, zstd->seek.compressed_ofs[frame], SEEK_SET) < 0 ||
-      zstd->base->read(zstd->base, compressed_data, compressed_size) < compressed_size)
-  {
-    MEM_freeN(compressed_data);
-    MEM_freeN(uncompressed_data);
-    return NULL;
+  /* Check if a prefetch already decompressed the wanted frame. */
+  char *uncompressed_data = NULL;
+  for (int i = 0; i < ZSTD_PREFETCH_NUM; i++) {
+    ZstdPrefetchSlot *slot = &zstd->seek.prefetch_slots[i];
+    if (slot->frame == frame && slot->uncompressed) {
+      uncompressed_data = slot->uncompressed;
+      slot->uncompressed = NULL;
+      slot->frame = -1;
+      break;
+    }
   }
 
-  size_t res = ZSTD_decompressDCtx(
-      zstd->ctx, uncompressed_data, uncompressed_size, compressed_data, compressed_size);
-  MEM_freeN(compressed_data);
-  if (ZSTD_isError(res) || res < uncompressed_size) {
-    MEM_freeN(uncompressed_data);
-    return NULL;
+  if (uncompressed_data == NULL) {
+    size_t compressed_size = zstd->seek.compressed_ofs[frame + 1] -
+                             zstd->seek.compressed_ofs[frame];
+    size_t uncompressed_size = zstd->seek.uncompressed_ofs[frame + 1] -
+                               zstd->seek.uncompressed_ofs[frame];
+
+    uncompressed_data = MEM_mallocN(uncompressed_size, __func__);
+    char *compressed_data = MEM_mallocN(compressed_size, __func__);
+    if (zstd->base->seek(zstd->base, zstd->seek.compressed_ofs[frame], SEEK_SET) < 0 ||
+        zstd->base->read(zstd->base, compressed_data, compressed_size) < compressed_size)
+    {
+      MEM_freeN(compressed_data);
+      MEM_freeN(uncompressed_data);
+      return NULL;
+    }
+
+    size_t res = ZSTD_decompressDCtx(
+        zstd->ctx, uncompressed_data, uncompressed_size, compressed_data, compressed_size);
+    MEM_freeN(compressed_data);
+    if (ZSTD_isError(res) || res < uncompressed_size) {
+      MEM_freeN(uncompressed_data);
+      return NULL;
+    }
   }
 
   zstd->seek.cached_frame = frame;
   zstd->seek.cached_content = uncompressed_data;
+
+  zstd_prefetch_start(zstd, frame);
+
   return uncompressed_data;
 }
 
@@ -281,6 +400,18 @@ static void zstd_close(FileReader *reader)
 
   ZSTD_freeDCtx(zstd->ctx);
   if (zstd->reader.seek) {
+    zstd_prefetch_wait(zstd);
+    if (zstd->seek.prefetch_pool) {
+      BLI_task_pool_free(zstd->seek.prefetch_pool);
+    }
+    for (int i = 0; i < ZSTD_PREFETCH_NUM; i++) {
+      ZstdPrefetchSlot *slot = &zstd->seek.prefetch_slots[i];
+      MEM_SAFE_FREE(slot->uncompressed);
+      MEM_SAFE_FREE(slot->compressed);
+      if (slot->ctx) {
+        ZSTD_freeDCtx(slot->ctx);
+      }
+    }
     MEM_freeN(zstd->seek.uncompressed_ofs);
     MEM_freeN(zstd->seek.compressed_ofs);
     /* When an error has occurred this may be NULL, see: #99744. */
@@ -386,6 +386,17 @@ BLI_INLINE float floor_fraction(float x, int &i)
   return x - x_floor;
 }
 
+/* NOTE: These kernels are scalar per point, and the multi-function callers in geometry/shader
+ * nodes already hand them dense index masks over thousands of points — the batching boundary
+ * exists, only the inner loop is narrow. A wide variant would evaluate N lanes of positions per
+ * call (struct-of-arrays spans in, span out), turning the hash/fade/mix chains into vertical
+ * operations; everything here is branch-free arithmetic except the lattice hash, which vectorizes
+ * as integer ops. Two cautions from past attempts at this: the `float4`-style types in
+ * BLI_math_vector_types.hh are geometric vectors, not lanes — using them as lanes reads
+ * naturally but compiles to shuffles around every `hash()` call; lane-width SoA with plain
+ * arrays auto-vectorizes better and stays ISA-neutral. And the fractal loops
+ * (perlin_fractal etc.) must be widened as a whole, not per octave, or the per-call overhead
+ * eats the gain. Any wide path must stay bit-exact with this scalar one: renders depend on it. */
 BLI_INLINE float perlin_noise(float position)
 {
   int X;
@@ -0,0 +1,147 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#include "BLI_profile.hh"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+
+#include "MEM_guardedalloc.h"
+
+#include "BLI_fileops.h"
+#include "BLI_string.h"
+#include "BLI_vector.hh"
+
+namespace blender::profile {
+
+struct Event {
+  const char *name;
+  const char *category;
+  uint64_t begin_ns;
+  uint64_t end_ns;
+};
+
+/**
+ * Fixed-capacity so that recording never allocates: ~2MB per recording thread. When a buffer
+ * fills up, further events on that thread are counted but dropped, and the drop count is
+ * reported when the trace is written.
+ */
+constexpr int64_t events_capacity = 1 << 16;
+
+struct ThreadBuffer {
+  int thread_index;
+  int64_t events_num = 0;
+  int64_t dropped_num = 0;
+  Event events[events_capacity];
+};
+
+/**
+ * Owns the buffers of all threads that ever recorded an event. Buffers are only appended while
+ * holding the mutex and are freed in #disable_and_write, not on thread exit, so that events from
+ * already finished threads still end up in the trace.
+ */
+static std::mutex g_buffers_mutex;
+static Vector<ThreadBuffer *> g_buffers;
+
+static char g_output_filepath[1024] = "";
+static std::chrono::steady_clock::time_point g_epoch;
+
+namespace detail {
+
+bool g_enabled = false;
+
+uint64_t clock_now_ns()
+{
+  return std::chrono::nanoseconds(std::chrono::steady_clock::now() - g_epoch).count();
+}
+
+static ThreadBuffer *thread_buffer_ensure()
+{
+  static thread_local ThreadBuffer *buffer = nullptr;
+  if (buffer == nullptr) {
+    buffer = MEM_new<ThreadBuffer>(__func__);
+    std::lock_guard lock(g_buffers_mutex);
+    buffer->thread_index = int(g_buffers.size());
+    g_buffers.append(buffer);
+  }
+  return buffer;
+}
+
+void add_event(const char *name, const char *category, uint64_t begin_ns, uint64_t end_ns)
+{
+  ThreadBuffer *buffer = thread_buffer_ensure();
+  if (buffer->events_num == events_capacity) {
+    buffer->dropped_num++;
+    return;
+  }
+  buffer->events[buffer->events_num++] = {name, category, begin_ns, end_ns};
+}
+
+}  // namespace detail
+
+void enable(const char *filepath)
+{
+  if (detail::g_enabled) {
+    return;
+  }
+  STRNCPY(g_output_filepath, filepath);
+  g_epoch = std::chrono::steady_clock::now();
+  /* Write the trace even when the process does not go through a clean exit path. */
+  std::atexit(disable_and_write);
+  detail::g_enabled = true;
+}
+
+void disable_and_write()
+{
+  if (!detail::g_enabled) {
+    return;
+  }
+  detail::g_enabled = false;
+
+  FILE *file = BLI_fopen(g_output_filepath, "w");
+  if (file == nullptr) {
+    fprintf(stderr, "Unable to write profile trace to '%s'\n", g_output_filepath);
+    return;
+  }
+
+  std::lock_guard lock(g_buffers_mutex);
+
+  /* Chrome trace format: https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU
+   * Timestamps and durations are in microseconds, but fractions are allowed. */
+  fprintf(file, "{\"traceEvents\":[\n");
+  bool is_first = true;
+  for (const ThreadBuffer *buffer : g_buffers) {
+    for (const int64_t i : IndexRange(buffer->events_num)) {
+      const Event &event = buffer->events[i];
+      fprintf(file,
+              "%s{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,"
+              "\"pid\":0,\"tid\":%d}",
+              is_first ? "" : ",\n",
+              event.name,
+              event.category,
+              double(event.begin_ns) / 1000.0,
+              double(event.end_ns - event.begin_ns) / 1000.0,
+              buffer->thread_index);
+      is_first = false;
+    }
+    if (buffer->dropped_num > 0) {
+      fprintf(stderr,
+              "Profile trace: dropped %d events on thread %d (buffer full)\n",
+              int(buffer->dropped_num),
+              buffer->thread_index);
+    }
+  }
+  fprintf(file, "\n]}\n");
+  fclose(file);
+
+  for (ThreadBuffer *buffer : g_buffers) {
+    MEM_delete(buffer);
+  }
+  g_buffers.clear();
+}
+
+}  // namespace blender::profile
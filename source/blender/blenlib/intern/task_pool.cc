@@ -12,6 +12,15 @@
 #include <memory>
 #include <utility>
 
+#ifndef WITH_TBB
+#  include <atomic>
+#  include <condition_variable>
+#  include <deque>
+#  include <mutex>
+#  include <thread>
+#  include <vector>
+#endif
+
 #include "MEM_guardedalloc.h"
 
 #include "DNA_listBase.h"
@@ -130,6 +139,198 @@ class TBBTaskGroup : public tbb::task_group {
 };
 #endif
 
+/* Work-Stealing Scheduler.
+ *
+ * Fallback scheduler used when building without TBB while multiple threads
+ * are available. Each worker thread owns a deque: it pushes and pops tasks
+ * on its own end (LIFO, for cache locality), while idle workers steal the
+ * oldest task (FIFO) from a sibling's deque. Threads that push from within a
+ * running task push onto their own deque, keeping related work local.
+ *
+ * The thread calling work_and_wait() participates in execution, so nested
+ * pools keep making progress through stealing instead of serializing. */
+
+#ifndef WITH_TBB
+
+class WorkStealingQueue {
+ private:
+  std::mutex mutex_;
+  std::deque<Task *> tasks_;
+
+ public:
+  void push(Task *task)
+  {
+    std::lock_guard lock(mutex_);
+    tasks_.push_back(task);
+  }
+
+  /* Pop the most recently pushed task, only called by the owning thread. */
+  Task *pop()
+  {
+    std::lock_guard lock(mutex_);
+    if (tasks_.empty()) {
+      return nullptr;
+    }
+    Task *task = tasks_.back();
+    tasks_.pop_back();
+    return task;
+  }
+
+  /* Steal the oldest task, called by sibling threads running out of work. */
+  Task *steal()
+  {
+    std::lock_guard lock(mutex_);
+    if (tasks_.empty()) {
+      return nullptr;
+    }
+    Task *task = tasks_.front();
+    tasks_.pop_front();
+    return task;
+  }
+};
+
+class WorkStealingScheduler {
+ private:
+  std::vector<std::unique_ptr<WorkStealingQueue>> queues_;
+  std::vector<std::thread> workers_;
+  std::mutex sleep_mutex_;
+  std::condition_variable sleep_cond_;
+  /* Number of tasks pushed but not yet finished executing. */
+  std::atomic<int> pending_ = 0;
+  std::atomic<int> round_robin_ = 0;
+  std::atomic<bool> stop_ = false;
+  std::atomic<bool> is_canceling_ = false;
+
+  /* Deque owned by the current thread, -1 for threads outside the pool. */
+  static thread_local int local_queue_index;
+
+ public:
+  WorkStealingScheduler(const int threads_num)
+  {
+    queues_.reserve(threads_num);
+    for (int i = 0; i < threads_num; i++) {
+      queues_.push_back(std::make_unique<WorkStealingQueue>());
+    }
+    /* Queue 0 is reserved for the thread that waits on the pool. */
+    for (int i = 1; i < threads_num; i++) {
+      workers_.emplace_back([this, i]() { this->worker_main(i); });
+    }
+  }
+
+  ~WorkStealingScheduler()
+  {
+    {
+      std::lock_guard lock(sleep_mutex_);
+      stop_ = true;
+    }
+    sleep_cond_.notify_all();
+    for (std::thread &worker : workers_) {
+      worker.join();
+    }
+  }
+
+  void push(Task *task)
+  {
+    int index = local_queue_index;
+    if (index < 0) {
+      /* Distribute pushes from outside threads round-robin over the deques. */
+      index = round_robin_.fetch_add(1, std::memory_order_relaxed) % int(queues_.size());
+    }
+    queues_[index]->push(task);
+    pending_.fetch_add(1);
+    sleep_cond_.notify_one();
+  }
+
+  void work_and_wait()
+  {
+    /* Adopt queue 0 so tasks pushed from tasks run here stay local. */
+    const int prev_index = local_queue_index;
+    local_queue_index = 0;
+    while (pending_.load() > 0) {
+      if (Task *task = find_task(0)) {
+        execute(task);
+      }
+      else {
+        /* All remaining tasks are currently running on other threads. */
+        std::this_thread::yield();
+      }
+    }
+    local_queue_index = prev_index;
+  }
+
+  void cancel()
+  {
+    is_canceling_ = true;
+    /* Discard tasks that have not started yet, then wait for the running
+     * ones to finish or cancel themselves. */
+    for (std::unique_ptr<WorkStealingQueue> &queue : queues_) {
+      while (Task *task = queue->steal()) {
+        free_task(task);
+        pending_.fetch_sub(1);
+      }
+    }
+    while (pending_.load() > 0) {
+      std::this_thread::yield();
+    }
+    is_canceling_ = false;
+  }
+
+  bool is_canceling() const
+  {
+    return is_canceling_;
+  }
+
+ private:
+  void worker_main(const int index)
+  {
+    local_queue_index = index;
+    while (true) {
+      if (Task *task = find_task(index)) {
+        execute(task);
+        continue;
+      }
+      std::unique_lock lock(sleep_mutex_);
+      sleep_cond_.wait(lock, [this]() { return stop_ || pending_.load() > 0; });
+      if (stop_) {
+        return;
+      }
+    }
+  }
+
+  Task *find_task(const int index)
+  {
+    if (Task *task = queues_[index]->pop()) {
+      return task;
+    }
+    const int queues_num = int(queues_.size());
+    for (int offset = 1; offset < queues_num; offset++) {
+      if (Task *task = queues_[(index + offset) % queues_num]->steal()) {
+        return task;
+      }
+    }
+    return nullptr;
+  }
+
+  void execute(Task *task)
+  {
+    if (!is_canceling_) {
+      (*task)();
+    }
+    free_task(task);
+    pending_.fetch_sub(1);
+  }
+
+  static void free_task(Task *task)
+  {
+    task->~Task();
+    MEM_freeN(task);
+  }
+};
+
+thread_local int WorkStealingScheduler::local_queue_index = -1;
+
+#endif /* !WITH_TBB */
+
 /* Task Pool */
 
 enum TaskPoolType {
@@ -150,6 +351,9 @@ struct TaskPool {
 #ifdef WITH_TBB
   /* TBB task pool. */
   TBBTaskGroup tbb_group;
+#else
+  /* Work-stealing scheduler used when threads are available without TBB. */
+  WorkStealingScheduler *work_stealing;
 #endif
   volatile bool is_suspended;
   BLI_mempool *suspended_mempool;
@@ -186,6 +390,10 @@ static void tbb_task_pool_create(TaskPool *pool, eTaskPriority priority)
     new (&pool->tbb_group) TBBTaskGroup(priority);
   }
 #else
+  if (pool->use_threads) {
+    pool->work_stealing = MEM_new<WorkStealingScheduler>(__func__,
+                                                         BLI_task_scheduler_num_threads());
+  }
   UNUSED_VARS(priority);
 #endif
 }
@@ -209,6 +417,13 @@ static void tbb_task_pool_run(TaskPool *pool, Task &&task)
     /* Execute in TBB task group. */
     pool->tbb_group.run(std::move(task));
   }
+#else
+  else if (pool->use_threads) {
+    /* Push onto the work-stealing deque of the current thread. */
+    Task *task_mem = (Task *)MEM_mallocN(sizeof(Task), __func__);
+    new (task_mem) Task(std::move(task));
+    pool->work_stealing->push(task_mem);
+  }
 #endif
   else {
     /* Execute immediately. */
@@ -238,6 +453,12 @@ static void tbb_task_pool_work_and_wait(TaskPool *pool)
      * out of threads and get stuck. */
     pool->tbb_group.wait();
   }
+#else
+  if (pool->use_threads) {
+    /* The waiting thread executes and steals tasks itself, for the same
+     * reason as the TBB wait() above. */
+    pool->work_stealing->work_and_wait();
+  }
 #endif
 }
 
@@ -249,7 +470,9 @@ static void tbb_task_pool_cancel(TaskPool *pool)
     pool->tbb_group.wait();
   }
 #else
-  UNUSED_VARS(pool);
+  if (pool->use_threads) {
+    pool->work_stealing->cancel();
+  }
 #endif
 }
 
@@ -260,7 +483,9 @@ static bool tbb_task_pool_canceled(TaskPool *pool)
     return tbb::is_current_task_group_canceling();
   }
 #else
-  UNUSED_VARS(pool);
+  if (pool->use_threads) {
+    return pool->work_stealing->is_canceling();
+  }
 #endif
 
   return false;
@@ -272,6 +497,10 @@ static void tbb_task_pool_free(TaskPool *pool)
   if (pool->use_threads) {
     pool->tbb_group.~TBBTaskGroup();
   }
+#else
+  if (pool->work_stealing) {
+    MEM_delete(pool->work_stealing);
+  }
 #endif
 
   if (pool->suspended_mempool) {
@@ -8,6 +8,8 @@
  * Task parallel range functions.
  */
 
+#include <algorithm>
+#include <array>
 #include <cstdlib>
 
 #include "MEM_guardedalloc.h"
@@ -18,6 +20,7 @@
 #include "BLI_task.h"
 #include "BLI_task.hh"
 #include "BLI_threads.h"
+#include "BLI_vector.hh"
 
 #include "atomic_ops.h"
 
@@ -181,4 +184,58 @@ void parallel_for_impl(const IndexRange range,
   function(range);
 }
 
+void parallel_for_weighted_impl(
+    const IndexRange range,
+    const int64_t grain_size,
+    const FunctionRef<void(IndexRange)> function,
+    const FunctionRef<void(IndexRange, MutableSpan<int64_t>)> task_sizes_fn)
+{
+#ifdef WITH_TBB
+  if (BLI_task_scheduler_num_threads() > 1) {
+    /* Compute the task sizes in fixed size chunks so that the temporary buffer does not grow with
+     * the range and the boundary scan stays cache friendly for very large ranges. */
+    constexpr int64_t sizes_chunk_size = 4096;
+    std::array<int64_t, sizes_chunk_size> sizes;
+
+    /* The first index of every task, followed by the end of the whole range. A task is cut off
+     * whenever its accumulated size reaches #grain_size, so small elements are packed together
+     * while large elements still end up in tasks of their own. */
+    Vector<int64_t> task_bounds;
+    task_bounds.append(range.first());
+    int64_t accumulated_size = 0;
+    for (int64_t chunk_start = 0; chunk_start < range.size(); chunk_start += sizes_chunk_size) {
+      const IndexRange chunk = range.slice(
+          chunk_start, std::min(sizes_chunk_size, range.size() - chunk_start));
+      task_sizes_fn(chunk, MutableSpan(sizes.data(), chunk.size()));
+      for (const int64_t i : chunk.index_range()) {
+        BLI_assert(sizes[i] >= 0);
+        accumulated_size += sizes[i];
+        if (accumulated_size >= grain_size) {
+          task_bounds.append(chunk[i] + 1);
+          accumulated_size = 0;
+        }
+      }
+    }
+    if (task_bounds.last() != range.one_after_last()) {
+      task_bounds.append(range.one_after_last());
+    }
+
+    if (task_bounds.size() > 2) {
+      lazy_threading::send_hint();
+      tbb::parallel_for(tbb::blocked_range<int64_t>(0, task_bounds.size() - 1, 1),
+                        [&](const tbb::blocked_range<int64_t> &tasks) {
+                          for (int64_t task = tasks.begin(); task != tasks.end(); task++) {
+                            const int64_t begin = task_bounds[task];
+                            function(IndexRange(begin, task_bounds[task + 1] - begin));
+                          }
+                        });
+      return;
+    }
+  }
+#else
+  UNUSED_VARS(grain_size, task_sizes_fn);
+#endif
+  function(range);
+}
+
 }  // namespace blender::threading::detail
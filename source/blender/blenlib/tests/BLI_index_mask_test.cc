@@ -145,6 +145,44 @@ TEST(index_mask, ToRange)
   }
 }
 
+TEST(index_mask, IsRange)
+{
+  IndexMaskMemory memory;
+  {
+    const IndexMask mask{IndexRange(16000, 40000)};
+    EXPECT_TRUE(mask.is_range());
+  }
+  {
+    const IndexMask mask = IndexMask::from_indices<int>({}, memory);
+    EXPECT_TRUE(mask.is_range());
+  }
+  {
+    const IndexMask mask = IndexMask::from_indices<int>({0, 1, 3, 4}, memory);
+    EXPECT_FALSE(mask.is_range());
+  }
+}
+
+TEST(index_mask, DevirtualizeIndexMask)
+{
+  IndexMaskMemory memory;
+  {
+    const IndexMask mask{IndexRange(100, 50000)};
+    devirtualize_index_mask(mask, [&](const auto &mask_or_range) {
+      constexpr bool is_range = std::is_same_v<std::decay_t<decltype(mask_or_range)>, IndexRange>;
+      EXPECT_TRUE(is_range);
+      EXPECT_EQ(mask_or_range.size(), 50000);
+    });
+  }
+  {
+    const IndexMask mask = IndexMask::from_indices<int>({2, 4, 8}, memory);
+    devirtualize_index_mask(mask, [&](const auto &mask_or_range) {
+      constexpr bool is_range = std::is_same_v<std::decay_t<decltype(mask_or_range)>, IndexRange>;
+      EXPECT_FALSE(is_range);
+      EXPECT_EQ(mask_or_range.size(), 3);
+    });
+  }
+}
+
 TEST(index_mask, FromRange)
 {
   const auto test_range = [](const IndexRange range) {
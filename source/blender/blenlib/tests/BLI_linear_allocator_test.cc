@@ -4,6 +4,7 @@
 
 #include "BLI_linear_allocator.hh"
 #include "BLI_rand.hh"
+#include "BLI_set.hh"
 #include "BLI_strict_flags.h"
 #include "testing/testing.h"
 
@@ -170,4 +171,27 @@ TEST(linear_allocator, TransferOwnership)
   EXPECT_EQ(values[index], value);
 }
 
+TEST(linear_allocator, ContainerAllocator)
+{
+  LinearAllocator<> allocator;
+
+  Set<int,
+      default_inline_buffer_capacity(sizeof(int)),
+      DefaultProbingStrategy,
+      DefaultHash<int>,
+      DefaultEquality<int>,
+      typename DefaultSetSlot<int>::type,
+      LinearContainerAllocator<>>
+      set{allocator};
+
+  /* Enough elements to force several grows, whose storage all ends up in the allocator. */
+  for (const int i : IndexRange(10000)) {
+    set.add(int(i));
+  }
+  EXPECT_EQ(set.size(), 10000);
+  for (const int i : IndexRange(10000)) {
+    EXPECT_TRUE(set.contains(int(i)));
+  }
+}
+
 }  // namespace blender::tests
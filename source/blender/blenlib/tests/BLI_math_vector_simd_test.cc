@@ -0,0 +1,92 @@
+/* SPDX-FileCopyrightText: 2023 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include "testing/testing.h"
+
+#include "BLI_array.hh"
+#include "BLI_math_vector_simd.hh"
+#include "BLI_rand.hh"
+
+namespace blender::tests {
+
+/* Not a multiple of the SIMD width, so the scalar tail is covered too. */
+static constexpr int64_t test_size = 4 * 25 + 3;
+
+static Array<float3> random_vectors(const uint32_t seed)
+{
+  RandomNumberGenerator rng(seed);
+  Array<float3> vectors(test_size);
+  for (float3 &vector : vectors) {
+    vector = float3(rng.get_float(), rng.get_float(), rng.get_float()) * 20.0f - 10.0f;
+  }
+  return vectors;
+}
+
+TEST(math_vector_simd, NormalizeSpan)
+{
+  Array<float3> vectors = random_vectors(0);
+  /* Degenerate vectors have to become zero, exactly like #math::normalize. */
+  vectors[1] = float3(0.0f);
+  vectors[50] = float3(1.0e-20f);
+
+  Array<float3> normalized(test_size);
+  math::normalize_span(vectors.as_span(), normalized);
+  for (const int64_t i : vectors.index_range()) {
+    const float3 expected = math::normalize(vectors[i]);
+    EXPECT_NEAR(normalized[i].x, expected.x, 1e-6f);
+    EXPECT_NEAR(normalized[i].y, expected.y, 1e-6f);
+    EXPECT_NEAR(normalized[i].z, expected.z, 1e-6f);
+  }
+
+  /* The in-place overload has to give the same result. */
+  math::normalize_span(vectors);
+  for (const int64_t i : vectors.index_range()) {
+    EXPECT_EQ(vectors[i], normalized[i]);
+  }
+}
+
+TEST(math_vector_simd, DotSpan)
+{
+  Array<float3> a = random_vectors(1);
+  Array<float3> b = random_vectors(2);
+  Array<float> dots(test_size);
+  math::dot_span(a, b, dots);
+  for (const int64_t i : a.index_range()) {
+    EXPECT_NEAR(dots[i], math::dot(a[i], b[i]), 1e-5f);
+  }
+}
+
+TEST(math_vector_simd, CrossSpan)
+{
+  Array<float3> a = random_vectors(3);
+  Array<float3> b = random_vectors(4);
+  Array<float3> crosses(test_size);
+  math::cross_span(a, b, crosses);
+  for (const int64_t i : a.index_range()) {
+    const float3 expected = math::cross(a[i], b[i]);
+    EXPECT_NEAR(crosses[i].x, expected.x, 1e-5f);
+    EXPECT_NEAR(crosses[i].y, expected.y, 1e-5f);
+    EXPECT_NEAR(crosses[i].z, expected.z, 1e-5f);
+  }
+}
+
+TEST(math_vector_simd, MaddSpan)
+{
+  Array<float3> vectors = random_vectors(5);
+  RandomNumberGenerator rng(6);
+  Array<float> factors(test_size);
+  for (float &factor : factors) {
+    factor = rng.get_float() * 4.0f - 2.0f;
+  }
+  Array<float3> accumulated(test_size, float3(1.0f, 2.0f, 3.0f));
+  math::madd_span(vectors, factors, accumulated);
+  for (const int64_t i : vectors.index_range()) {
+    const float3 expected = float3(1.0f, 2.0f, 3.0f) + vectors[i] * factors[i];
+    EXPECT_NEAR(accumulated[i].x, expected.x, 1e-5f);
+    EXPECT_NEAR(accumulated[i].y, expected.y, 1e-5f);
+    EXPECT_NEAR(accumulated[i].z, expected.z, 1e-5f);
+  }
+}
+
+}  // namespace blender::tests
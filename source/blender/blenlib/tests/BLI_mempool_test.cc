@@ -0,0 +1,74 @@
+/* SPDX-FileCopyrightText: 2023 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include "testing/testing.h"
+
+#include "BLI_mempool.h"
+#include "BLI_task.hh"
+
+namespace blender::tests {
+
+TEST(mempool, MergeKeepsElements)
+{
+  BLI_mempool *pool_a = BLI_mempool_create(sizeof(int), 0, 64, BLI_MEMPOOL_ALLOW_ITER);
+  BLI_mempool *pool_b = BLI_mempool_create(sizeof(int), 0, 64, BLI_MEMPOOL_ALLOW_ITER);
+
+  const int elems_num = 100;
+  for (int i = 0; i < elems_num; i++) {
+    *static_cast<int *>(BLI_mempool_alloc(pool_a)) = i;
+    *static_cast<int *>(BLI_mempool_alloc(pool_b)) = elems_num + i;
+  }
+
+  BLI_mempool_merge(pool_a, pool_b);
+  EXPECT_EQ(BLI_mempool_len(pool_a), 2 * elems_num);
+
+  /* Iteration visits the destination pool elements first, in allocation order. */
+  BLI_mempool_iter iter;
+  BLI_mempool_iternew(pool_a, &iter);
+  int index = 0;
+  while (int *elem = static_cast<int *>(BLI_mempool_iterstep(&iter))) {
+    EXPECT_EQ(*elem, index);
+    index++;
+  }
+  EXPECT_EQ(index, 2 * elems_num);
+
+  BLI_mempool_destroy(pool_a);
+}
+
+TEST(mempool, ShardedParallelAlloc)
+{
+  const int shards_num = 4;
+  const int elems_per_shard = 1000;
+
+  BLI_sharded_mempool *sharded = BLI_sharded_mempool_create(
+      sizeof(int), 0, 128, BLI_MEMPOOL_ALLOW_ITER, shards_num);
+
+  threading::parallel_for(IndexRange(shards_num), 1, [&](const IndexRange range) {
+    for (const int shard : range) {
+      BLI_mempool *pool = BLI_sharded_mempool_shard(sharded, shard);
+      for (int i = 0; i < elems_per_shard; i++) {
+        *static_cast<int *>(BLI_mempool_alloc(pool)) = shard;
+      }
+    }
+  });
+
+  BLI_mempool *merged = BLI_sharded_mempool_merge(sharded);
+  EXPECT_EQ(BLI_mempool_len(merged), shards_num * elems_per_shard);
+
+  int counts[shards_num] = {0};
+  BLI_mempool_iter iter;
+  BLI_mempool_iternew(merged, &iter);
+  while (int *elem = static_cast<int *>(BLI_mempool_iterstep(&iter))) {
+    ASSERT_GE(*elem, 0);
+    ASSERT_LT(*elem, shards_num);
+    counts[*elem]++;
+  }
+  for (int shard = 0; shard < shards_num; shard++) {
+    EXPECT_EQ(counts[shard], elems_per_shard);
+  }
+
+  BLI_mempool_destroy(merged);
+}
+
+}  // namespace blender::tests
@@ -0,0 +1,81 @@
+/* SPDX-FileCopyrightText: 2023 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include "testing/testing.h"
+
+#include <algorithm>
+
+#include "BLI_array.hh"
+#include "BLI_rand.hh"
+#include "BLI_sort.hh"
+
+namespace blender::tests {
+
+template<typename T, typename Fn> static void assert_sorts_like_std_sort(Fn &&make_value)
+{
+  /* Large enough to take the radix path, with a remainder chunk. */
+  const int64_t size = (1 << 17) + 123;
+  RandomNumberGenerator rng(0);
+
+  Array<T> values(size);
+  for (T &value : values) {
+    value = make_value(rng);
+  }
+  Array<T> values_expect = values;
+
+  parallel_sort(values.as_mutable_span());
+  std::sort(values_expect.begin(), values_expect.end());
+
+  ASSERT_EQ(values.size(), values_expect.size());
+  for (const int64_t i : values.index_range()) {
+    ASSERT_EQ(values[i], values_expect[i]);
+  }
+}
+
+TEST(sort, ParallelSortInt32)
+{
+  assert_sorts_like_std_sort<int32_t>(
+      [](RandomNumberGenerator &rng) { return int32_t(rng.get_uint32()); });
+}
+
+TEST(sort, ParallelSortUInt32)
+{
+  assert_sorts_like_std_sort<uint32_t>(
+      [](RandomNumberGenerator &rng) { return rng.get_uint32(); });
+}
+
+TEST(sort, ParallelSortInt64)
+{
+  assert_sorts_like_std_sort<int64_t>([](RandomNumberGenerator &rng) {
+    return int64_t(uint64_t(rng.get_uint32()) << 32 | rng.get_uint32());
+  });
+}
+
+TEST(sort, ParallelSortFloat)
+{
+  assert_sorts_like_std_sort<float>(
+      [](RandomNumberGenerator &rng) { return rng.get_float() * 2000.0f - 1000.0f; });
+}
+
+TEST(sort, ParallelSortSmallFallback)
+{
+  Array<int> values = {5, 3, 4, 1, 2};
+  parallel_sort(values.as_mutable_span());
+  const Array<int> expect = {1, 2, 3, 4, 5};
+  for (const int64_t i : values.index_range()) {
+    EXPECT_EQ(values[i], expect[i]);
+  }
+}
+
+TEST(sort, ParallelSortComparator)
+{
+  Array<int> values = {1, 3, 2, 5, 4};
+  parallel_sort(values.as_mutable_span(), std::greater<int>());
+  const Array<int> expect = {5, 4, 3, 2, 1};
+  for (const int64_t i : values.index_range()) {
+    EXPECT_EQ(values[i], expect[i]);
+  }
+}
+
+}  // namespace blender::tests
@@ -30,6 +30,9 @@ struct MemFileChunk {
   /** Session UUID of the ID being currently written (MAIN_ID_SESSION_UUID_UNSET when not writing
    * ID-related data). Used to find matching chunks in previous memundo step. */
   uint id_session_uuid;
+  /** Non-zero when #buf holds zstd-compressed data (#size stays the uncompressed size), see
+   * #BLO_memfile_compress. Only chunks that are not shared with other steps are compressed. */
+  size_t size_compressed;
 };
 
 struct MemFile {
@@ -90,6 +93,17 @@ extern void BLO_memfile_merge(MemFile *first, MemFile *second);
  * Clear is_identical_future before adding next memfile.
  */
 extern void BLO_memfile_clear_future(MemFile *memfile);
+/**
+ * Compress the chunks owned exclusively by \a memfile (undo steps that are no longer close to
+ * the active one, so their data is rarely touched). Reading the memfile decompresses it again,
+ * see #BLO_memfile_decompress.
+ */
+extern void BLO_memfile_compress(MemFile *memfile);
+/**
+ * Undo the effect of #BLO_memfile_compress. Called automatically before a memfile is read or
+ * used as reference for writing the next step; safe to call on uncompressed memfiles.
+ */
+extern void BLO_memfile_decompress(MemFile *memfile);
 
 /* Utilities. */
 
@@ -34,11 +34,16 @@
 #include "BKE_main.hh"
 #include "BKE_undo_system.h"
 
+#include <zstd.h>
+
 /* keep last */
 #include "BLI_strict_flags.h"
 
 /* **************** support for memory-write, for undo buffers *************** */
 
+/* Speed matters more than ratio here, cold steps are compressed during interaction. */
+#define MEMFILE_COMPRESSION_LEVEL 1
+
 void BLO_memfile_free(MemFile *memfile)
 {
   while (MemFileChunk *chunk = static_cast<MemFileChunk *>(BLI_pophead(&memfile->chunks))) {
@@ -97,12 +102,67 @@ void BLO_memfile_clear_future(MemFile *memfile)
   }
 }
 
+void BLO_memfile_compress(MemFile *memfile)
+{
+  LISTBASE_FOREACH (MemFileChunk *, chunk, &memfile->chunks) {
+    if (chunk->is_identical || chunk->is_identical_future || chunk->size_compressed != 0) {
+      /* Shared buffers may still be read through other steps, leave them alone. */
+      continue;
+    }
+    const size_t size_bound = ZSTD_compressBound(chunk->size);
+    char *buf_compressed = static_cast<char *>(MEM_mallocN(size_bound, "Chunk buffer"));
+    const size_t size_compressed = ZSTD_compress(
+        buf_compressed, size_bound, chunk->buf, chunk->size, MEMFILE_COMPRESSION_LEVEL);
+    if (ZSTD_isError(size_compressed) || size_compressed >= chunk->size) {
+      /* Not compressible, keep the raw buffer. */
+      MEM_freeN(buf_compressed);
+      continue;
+    }
+    /* Give back the slack from the worst-case allocation. */
+    char *buf_final = static_cast<char *>(MEM_mallocN(size_compressed, "Chunk buffer"));
+    memcpy(buf_final, buf_compressed, size_compressed);
+    MEM_freeN(buf_compressed);
+
+    MEM_freeN((void *)chunk->buf);
+    chunk->buf = buf_final;
+    chunk->size_compressed = size_compressed;
+    memfile->size -= chunk->size - size_compressed;
+  }
+}
+
+void BLO_memfile_decompress(MemFile *memfile)
+{
+  LISTBASE_FOREACH (MemFileChunk *, chunk, &memfile->chunks) {
+    if (chunk->size_compressed == 0) {
+      continue;
+    }
+    char *buf = static_cast<char *>(MEM_mallocN(chunk->size, "Chunk buffer"));
+    const size_t res = ZSTD_decompress(buf, chunk->size, chunk->buf, chunk->size_compressed);
+    if (ZSTD_isError(res) || res < chunk->size) {
+      /* Can only happen when the chunk memory was corrupted, there is nothing sensible to
+       * restore then. */
+      BLI_assert_unreachable();
+      MEM_freeN(buf);
+      continue;
+    }
+    MEM_freeN((void *)chunk->buf);
+    chunk->buf = buf;
+    memfile->size += chunk->size - chunk->size_compressed;
+    chunk->size_compressed = 0;
+  }
+}
+
 void BLO_memfile_write_init(MemFileWriteData *mem_data,
                             MemFile *written_memfile,
                             MemFile *reference_memfile)
 {
   mem_data->written_memfile = written_memfile;
   mem_data->reference_memfile = reference_memfile;
+  if (reference_memfile != nullptr) {
+    /* Chunk deduplication compares raw buffers, so a compressed reference step (e.g. after
+     * undoing back to a cold step) has to be expanded again first. */
+    BLO_memfile_decompress(reference_memfile);
+  }
   mem_data->reference_current_chunk = reference_memfile ? static_cast<MemFileChunk *>(
                                                               reference_memfile->chunks.first) :
                                                           nullptr;
@@ -156,6 +216,7 @@ void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t s
    * will then not be undo. Though it's not entirely clear that is wrong behavior. */
   curchunk->is_identical_future = true;
   curchunk->id_session_uuid = mem_data->current_id_session_uuid;
+  curchunk->size_compressed = 0;
   BLI_addtail(&memfile->chunks, curchunk);
 
   /* we compare compchunk with buf */
@@ -204,6 +265,8 @@ bool BLO_memfile_write_file(MemFile *memfile, const char *filepath)
   MemFileChunk *chunk;
   int file, oflags;
 
+  BLO_memfile_decompress(memfile);
+
   /* NOTE: This is currently used for auto-save and `quit.blend`,
    * where _not_ following symbolic-links is OK,
    * however if this is ever executed explicitly by the user,
@@ -336,6 +399,9 @@ static void undo_close(FileReader *reader)
 
 FileReader *BLO_memfile_new_filereader(MemFile *memfile, int undo_direction)
 {
+  /* The reader copies straight out of the chunk buffers, expand compressed cold steps. */
+  BLO_memfile_decompress(memfile);
+
   UndoReader *undo = static_cast<UndoReader *>(MEM_callocN(sizeof(UndoReader), __func__));
 
   undo->memfile = memfile;
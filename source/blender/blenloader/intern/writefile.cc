@@ -202,11 +202,18 @@ class ZstdWriteWrap : public WriteWrap {
   WriteWrap &base_wrap;
 
   ListBase threadpool = {};
+  /** Pending blocks, waiting for a worker to pick them up (bounded by #queue_limit). */
   ListBase tasks = {};
   ThreadMutex mutex = {};
   ThreadCondition condition = {};
   int next_frame = 0;
   int num_frames = 0;
+  /** Number of blocks in #tasks. The producer blocks once #queue_limit blocks are pending, so
+   * serialization can run ahead of compression without buffering the whole file. */
+  int queued_blocks = 0;
+  int queue_limit = 0;
+  /** Set on close, tells workers to exit once the queue has been drained. */
+  bool all_blocks_queued = false;
 
   ListBase frames = {};
 
@@ -221,6 +228,8 @@ class ZstdWriteWrap : public WriteWrap {
 
  private:
   struct ZstdWriteBlockTask;
+  static void *worker_thread(void *userdata);
+  void compress_queued_blocks();
   void write_task(ZstdWriteBlockTask *task);
   void write_u32_le(uint32_t val);
   void write_seekable_frames();
@@ -231,15 +240,40 @@ struct ZstdWriteWrap::ZstdWriteBlockTask {
   void *data;
   size_t size;
   int frame_number;
-  ZstdWriteWrap *ww;
+};
+
+void *ZstdWriteWrap::worker_thread(void *userdata)
+{
+  static_cast<ZstdWriteWrap *>(userdata)->compress_queued_blocks();
+  return nullptr;
+}
 
-  static void *write_task(void *userdata)
-  {
-    auto *task = static_cast<ZstdWriteBlockTask *>(userdata);
-    task->ww->write_task(task);
-    return nullptr;
+/**
+ * Worker main loop: pop blocks from the queue and compress them until the producer is done.
+ * Several workers run concurrently, so compression of later frames overlaps both with
+ * compression of earlier ones and with serialization of new blocks on the main thread.
+ */
+void ZstdWriteWrap::compress_queued_blocks()
+{
+  while (true) {
+    BLI_mutex_lock(&mutex);
+    while (BLI_listbase_is_empty(&tasks) && !all_blocks_queued) {
+      BLI_condition_wait(&condition, &mutex);
+    }
+    ZstdWriteBlockTask *task = static_cast<ZstdWriteBlockTask *>(BLI_pophead(&tasks));
+    if (task == nullptr) {
+      /* Queue is drained and no new blocks will come in, we're done. */
+      BLI_mutex_unlock(&mutex);
+      break;
+    }
+    queued_blocks--;
+    BLI_mutex_unlock(&mutex);
+    /* Wake up the producer in case it was waiting for queue space. */
+    BLI_condition_notify_all(&condition);
+
+    write_task(task);
   }
-};
+}
 
 void ZstdWriteWrap::write_task(ZstdWriteBlockTask *task)
 {
@@ -278,6 +312,7 @@ void ZstdWriteWrap::write_task(ZstdWriteBlockTask *task)
   BLI_condition_notify_all(&condition);
 
   MEM_freeN(out_buf);
+  MEM_freeN(task);
 }
 
 bool ZstdWriteWrap::open(const char *filepath)
@@ -288,9 +323,15 @@ bool ZstdWriteWrap::open(const char *filepath)
 
   /* Leave one thread open for the main writing logic, unless we only have one HW thread. */
   int num_threads = max_ii(1, BLI_system_thread_count() - 1);
-  BLI_threadpool_init(&threadpool, ZstdWriteBlockTask::write_task, num_threads);
+  /* Let serialization run a bit ahead of compression, without buffering arbitrary amounts of
+   * data when the disk or the compressors can't keep up. */
+  queue_limit = num_threads * 2;
   BLI_mutex_init(&mutex);
   BLI_condition_init(&condition);
+  BLI_threadpool_init(&threadpool, worker_thread, num_threads);
+  for (int i = 0; i < num_threads; i++) {
+    BLI_threadpool_insert(&threadpool, this);
+  }
 
   return true;
 }
@@ -338,8 +379,13 @@ void ZstdWriteWrap::write_seekable_frames()
 
 bool ZstdWriteWrap::close()
 {
+  /* Tell the workers to exit once the remaining blocks have been compressed, then join them. */
+  BLI_mutex_lock(&mutex);
+  all_blocks_queued = true;
+  BLI_mutex_unlock(&mutex);
+  BLI_condition_notify_all(&condition);
   BLI_threadpool_end(&threadpool);
-  BLI_freelistN(&tasks);
+  BLI_assert(BLI_listbase_is_empty(&tasks));
 
   BLI_mutex_end(&mutex);
   BLI_condition_end(&condition);
@@ -362,27 +408,17 @@ bool ZstdWriteWrap::write(const void *buf, size_t buf_len)
   memcpy(task->data, buf, buf_len);
   task->size = buf_len;
   task->frame_number = num_frames++;
-  task->ww = this;
 
+  /* Queue the block for the workers. Only block when the pipeline is full, so that on fast disks
+   * serialization and compression of consecutive blocks overlap fully. */
   BLI_mutex_lock(&mutex);
+  while (queued_blocks >= queue_limit) {
+    BLI_condition_wait(&condition, &mutex);
+  }
   BLI_addtail(&tasks, task);
-
-  /* If there's a free worker thread, just push the block into that thread.
-   * Otherwise, we wait for the earliest thread to finish.
-   * We look up the earliest thread while holding the mutex, but release it
-   * before joining the thread to prevent a deadlock. */
-  ZstdWriteBlockTask *first_task = static_cast<ZstdWriteBlockTask *>(tasks.first);
+  queued_blocks++;
   BLI_mutex_unlock(&mutex);
-  if (!BLI_available_threads(&threadpool)) {
-    BLI_threadpool_remove(&threadpool, first_task);
-
-    /* If the task list was empty before we pushed our task, there should
-     * always be a free thread. */
-    BLI_assert(first_task != task);
-    BLI_remlink(&tasks, first_task);
-    MEM_freeN(first_task);
-  }
-  BLI_threadpool_insert(&threadpool, task);
+  BLI_condition_notify_all(&condition);
 
   return true;
 }
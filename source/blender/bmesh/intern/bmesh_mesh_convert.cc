@@ -495,10 +495,10 @@ void BM_mesh_bm_from_me(BMesh *bm, const Mesh *mesh, const BMeshFromMeshParams *
   const Span<int> corner_verts = mesh->corner_verts();
   const Span<int> corner_edges = mesh->corner_edges();
 
-  /* Only needed for selection. */
+  /* Only needed for selection and deferred normal calculation. */
 
   Array<BMFace *> ftable;
-  if (mesh->mselect && mesh->totselect != 0) {
+  if ((mesh->mselect && mesh->totselect != 0) || params->calc_face_normal) {
     ftable.reinitialize(mesh->faces_num);
   }
 
@@ -552,15 +552,23 @@ void BM_mesh_bm_from_me(BMesh *bm, const Mesh *mesh, const BMeshFromMeshParams *
     } while ((l_iter = l_iter->next) != l_first);
 
     mesh_attributes_copy_to_bmesh_block(bm->pdata, poly_info, i, f->head);
-
-    if (params->calc_face_normal) {
-      BM_face_normal_update(f);
-    }
   }
   if (is_new) {
     bm->elem_index_dirty &= ~(BM_FACE | BM_LOOP); /* Added in order, clear dirty flag. */
   }
 
+  if (params->calc_face_normal) {
+    /* Done in a separate pass, so that the normals of all faces can be computed in parallel.
+     * Every face only reads its own loops and writes its own normal. */
+    threading::parallel_for(ftable.index_range(), 1024, [&](const IndexRange range) {
+      for (const int i : range) {
+        if (BMFace *f = ftable[i]) {
+          BM_face_normal_update(f);
+        }
+      }
+    });
+  }
+
   /* -------------------------------------------------------------------- */
   /* MSelect clears the array elements (to avoid adding multiple times).
    *
@@ -754,6 +762,7 @@ static int bm_to_mesh_shape_layer_index_from_kb(BMesh *bm, KeyBlock *currkey)
  */
 static void bm_to_mesh_shape(BMesh *bm,
                              Key *key,
+                             const Span<const BMVert *> bm_verts,
                              MutableSpan<float3> positions,
                              const bool active_shapekey_to_mvert)
 {
@@ -878,37 +887,40 @@ static void bm_to_mesh_shape(BMesh *bm,
       }
       currkey_data = (float(*)[3])currkey->data;
 
-      int i;
-      BM_ITER_MESH_INDEX (eve, &iter, bm, BM_VERTS_OF_MESH, i) {
-        float *co_orig = (float *)BM_ELEM_CD_GET_VOID_P(eve, cd_shape_offset);
-
-        if (currkey == actkey) {
-          copy_v3_v3(currkey_data[i], eve->co);
-
-          if (update_vertex_coords_from_refkey) {
-            BLI_assert(actkey != key->refkey);
-            keyi = BM_ELEM_CD_GET_INT(eve, cd_shape_keyindex_offset);
-            if (keyi != ORIGINDEX_NONE) {
-              float *co_refkey = (float *)BM_ELEM_CD_GET_VOID_P(eve, cd_shape_offset_refkey);
-              copy_v3_v3(positions[i], co_refkey);
+      /* Every vertex only reads and writes data of its own index, so this can run in parallel. */
+      blender::threading::parallel_for(bm_verts.index_range(), 1024, [&](const IndexRange range) {
+        for (const int i : range) {
+          BMVert *vert = const_cast<BMVert *>(bm_verts[i]);
+          float *co_orig = (float *)BM_ELEM_CD_GET_VOID_P(vert, cd_shape_offset);
+
+          if (currkey == actkey) {
+            copy_v3_v3(currkey_data[i], vert->co);
+
+            if (update_vertex_coords_from_refkey) {
+              BLI_assert(actkey != key->refkey);
+              const int keyi = BM_ELEM_CD_GET_INT(vert, cd_shape_keyindex_offset);
+              if (keyi != ORIGINDEX_NONE) {
+                float *co_refkey = (float *)BM_ELEM_CD_GET_VOID_P(vert, cd_shape_offset_refkey);
+                copy_v3_v3(positions[i], co_refkey);
+              }
             }
           }
-        }
-        else {
-          copy_v3_v3(currkey_data[i], co_orig);
-        }
+          else {
+            copy_v3_v3(currkey_data[i], co_orig);
+          }
 
-        /* Propagate edited basis offsets to other shapes. */
-        if (apply_offset) {
-          add_v3_v3(currkey_data[i], ofs[i]);
-        }
+          /* Propagate edited basis offsets to other shapes. */
+          if (apply_offset) {
+            add_v3_v3(currkey_data[i], ofs[i]);
+          }
 
-        /* Apply back new coordinates shape-keys that have offset into #BMesh.
-         * Otherwise, in case we call again #BM_mesh_bm_to_me on same #BMesh,
-         * we'll apply diff from previous call to #BM_mesh_bm_to_me,
-         * to shape-key values from original creation of the #BMesh. See #50524. */
-        copy_v3_v3(co_orig, currkey_data[i]);
-      }
+          /* Apply back new coordinates shape-keys that have offset into #BMesh.
+           * Otherwise, in case we call again #BM_mesh_bm_to_me on same #BMesh,
+           * we'll apply diff from previous call to #BM_mesh_bm_to_me,
+           * to shape-key values from original creation of the #BMesh. See #50524. */
+          copy_v3_v3(co_orig, currkey_data[i]);
+        }
+      });
     }
     else {
       /* No original layer data, use fallback information. */
@@ -1524,8 +1536,11 @@ void BM_mesh_bm_to_me(Main *bmain, BMesh *bm, Mesh *mesh, const BMeshToMeshParam
       [&]() {
         bm_to_mesh_verts(*bm, vert_table, *mesh, select_vert.span, hide_vert.span);
         if (mesh->key) {
-          bm_to_mesh_shape(
-              bm, mesh->key, mesh->vert_positions_for_write(), params->active_shapekey_to_mvert);
+          bm_to_mesh_shape(bm,
+                           mesh->key,
+                           vert_table,
+                           mesh->vert_positions_for_write(),
+                           params->active_shapekey_to_mvert);
         }
       },
       [&]() {
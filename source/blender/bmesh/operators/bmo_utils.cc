@@ -18,6 +18,7 @@
 #include "BLI_alloca.h"
 #include "BLI_math_matrix.h"
 #include "BLI_math_vector.h"
+#include "BLI_task.hh"
 
 #include "BKE_attribute.hh"
 #include "BKE_customdata.hh"
@@ -401,14 +402,14 @@ void bmo_region_extend_exec(BMesh *bm, BMOperator *op)
 void bmo_smooth_vert_exec(BMesh * /*bm*/, BMOperator *op)
 {
   BMOIter siter;
-  BMIter iter;
   BMVert *v;
-  BMEdge *e;
-  float(*cos)[3] = static_cast<float(*)[3]>(
-      MEM_mallocN(sizeof(*cos) * BMO_slot_buffer_len(op->slots_in, "verts"), __func__));
-  float *co, *co2, clip_dist = BMO_slot_float_get(op->slots_in, "clip_dist");
+  BMOpSlot *slot_verts = BMO_slot_get(op->slots_in, "verts");
+  BMVert **verts = reinterpret_cast<BMVert **>(BMO_SLOT_AS_BUFFER(slot_verts));
+  const int verts_len = slot_verts->len;
+  float(*cos)[3] = static_cast<float(*)[3]>(MEM_mallocN(sizeof(*cos) * verts_len, __func__));
+  const float clip_dist = BMO_slot_float_get(op->slots_in, "clip_dist");
   const float fac = BMO_slot_float_get(op->slots_in, "factor");
-  int i, j, clipx, clipy, clipz;
+  int i, clipx, clipy, clipz;
   int xaxis, yaxis, zaxis;
 
   clipx = BMO_slot_bool_get(op->slots_in, "mirror_clip_x");
@@ -419,40 +420,43 @@ void bmo_smooth_vert_exec(BMesh * /*bm*/, BMOperator *op)
   yaxis = BMO_slot_bool_get(op->slots_in, "use_axis_y");
   zaxis = BMO_slot_bool_get(op->slots_in, "use_axis_z");
 
-  i = 0;
-  BMO_ITER (v, &siter, op->slots_in, "verts", BM_VERT) {
-
-    co = cos[i];
-    zero_v3(co);
-
-    j = 0;
-    BM_ITER_ELEM (e, &iter, v, BM_EDGES_OF_VERT) {
-      co2 = BM_edge_other_vert(e, v)->co;
-      add_v3_v3v3(co, co, co2);
-      j += 1;
-    }
-
-    if (!j) {
-      copy_v3_v3(co, v->co);
-      i++;
-      continue;
-    }
+  /* The neighborhood queries only read the mesh and every vertex writes its own slot in `cos`,
+   * so the new locations can be computed in parallel; they are applied in a second pass below. */
+  blender::threading::parallel_for(
+      blender::IndexRange(verts_len), 512, [&](const blender::IndexRange range) {
+        for (const int vert_i : range) {
+          BMVert *vert = verts[vert_i];
+          BMIter iter;
+          BMEdge *e;
+          float *co = cos[vert_i];
+          zero_v3(co);
+
+          int j = 0;
+          BM_ITER_ELEM (e, &iter, vert, BM_EDGES_OF_VERT) {
+            const float *co2 = BM_edge_other_vert(e, vert)->co;
+            add_v3_v3v3(co, co, co2);
+            j += 1;
+          }
 
-    mul_v3_fl(co, 1.0f / float(j));
-    interp_v3_v3v3(co, v->co, co, fac);
+          if (!j) {
+            copy_v3_v3(co, vert->co);
+            continue;
+          }
 
-    if (clipx && fabsf(v->co[0]) <= clip_dist) {
-      co[0] = 0.0f;
-    }
-    if (clipy && fabsf(v->co[1]) <= clip_dist) {
-      co[1] = 0.0f;
-    }
-    if (clipz && fabsf(v->co[2]) <= clip_dist) {
-      co[2] = 0.0f;
-    }
+          mul_v3_fl(co, 1.0f / float(j));
+          interp_v3_v3v3(co, vert->co, co, fac);
 
-    i++;
-  }
+          if (clipx && fabsf(vert->co[0]) <= clip_dist) {
+            co[0] = 0.0f;
+          }
+          if (clipy && fabsf(vert->co[1]) <= clip_dist) {
+            co[1] = 0.0f;
+          }
+          if (clipz && fabsf(vert->co[2]) <= clip_dist) {
+            co[2] = 0.0f;
+          }
+        }
+      });
 
   i = 0;
   BMO_ITER (v, &siter, op->slots_in, "verts", BM_VERT) {
@@ -7809,7 +7809,18 @@ void BM_mesh_bevel(BMesh *bm,
 
   math_layer_info_init(&bp, bm);
 
-  /* Analyze input vertices, sorting edges and assigning initial new vertex positions. */
+  /* Analyze input vertices, sorting edges and assigning initial new vertex positions.
+   *
+   * NOTE: Every phase from here on is serial over the tagged vertices, which is why parameter
+   * tweaks on dense hard-surface meshes pay seconds per change. The analysis and vmesh
+   * construction phases are parallelizable by connectivity groups: two #BevVert are dependent
+   * only if connected through a chain of beveled edges (offset adjustment, profile matching and
+   * weld propagation all walk those chains), so grouping tagged vertices with a union-find over
+   * beveled edges yields independent islands that can run concurrently, each with its own arena
+   * in place of the shared `bp.mem_arena`, and `bp.vert_hash` sharded per island. What cannot
+   * move off the main thread is everything that mutates the BMesh itself -- vertex/face
+   * creation, attribute interpolation and the final rebuild -- since BMesh allocation is not
+   * thread-safe; the build phases stay a serial pass per island over precomputed data. */
   BM_ITER_MESH (v, &iter, bm, BM_VERTS_OF_MESH) {
     if (BM_elem_flag_test(v, BM_ELEM_TAG)) {
       bv = bevel_vert_construct(bm, &bp, v);
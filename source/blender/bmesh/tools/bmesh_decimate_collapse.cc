@@ -1274,6 +1274,18 @@ static bool bm_decim_edge_collapse(BMesh *bm,
 /* Main Decimate Function
  * ********************** */
 
+/* NOTE: Each call starts from the full mesh and collapses down to the requested factor, so
+ * dragging the ratio slider recomputes everything per notch. The collapse ordering itself is
+ * almost independent of the factor -- the heap pops the same sequence of cheapest edges, the
+ * factor only decides where to stop (quadrics drift slightly as earlier stops skip later
+ * updates, which LOD use tolerates). A progressive-mesh cache on the modifier would make slider
+ * drags incremental: run the full collapse once recording each step as (edge verts, resulting
+ * position, removed faces' attribute data), then answer a new ratio by replaying forward from
+ * the current state or rebuilding from the original and replaying -- true unwinding would need
+ * vertex-split records, which the attribute interpolation below doesn't retain. The cache
+ * belongs in the decimate modifier's runtime (invalidated by any upstream mesh change), not in
+ * this function, which stays the one-shot primitive; what this file needs to expose is a
+ * variant that emits the step stream instead of applying it. */
 void BM_mesh_decimate_collapse(BMesh *bm,
                                const float factor,
                                float *vweights,
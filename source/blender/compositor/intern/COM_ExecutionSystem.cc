@@ -93,6 +93,18 @@ void ExecutionSystem::set_operations(const Vector<NodeOperation *> &operations,
   groups_ = groups;
 }
 
+/* NOTE: Each frame of a sequence render constructs a fresh ExecutionSystem and recomputes every
+ * branch, including ones whose inputs cannot change over time (still-image inputs, masks without
+ * animation, ID mask chains off stills). Cross-frame reuse needs two pieces. Time-dependence
+ * classification is the cheap one: an operation is time-varying if it reads the render result,
+ * an image sequence/movie, or any animated value — `BuildContext`/node-tree animation data can
+ * answer this at builder time, and the property propagates down the operation DAG like canvas
+ * info does. Persistence is the structural problem: operations and their MemoryBuffers die with
+ * this system at frame end, so invariant subtree results would have to be exported to a cache
+ * owned by the caller that survives the per-frame loop (keyed by node-tree/subtree hash, with a
+ * byte budget evicting largest-first), and re-imported as constant inputs when the next frame's
+ * system is built. The buffer-level caches that exist today (cached operation types) are
+ * per-system and do not cross frames. */
 void ExecutionSystem::execute()
 {
   DebugInfo::execute_started(this);
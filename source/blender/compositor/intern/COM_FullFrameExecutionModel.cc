@@ -122,6 +122,17 @@ void FullFrameExecutionModel::render_operation(NodeOperation *op)
   operation_finished(op);
 }
 
+/* NOTE: Every operation materializes a full-canvas #MemoryBuffer before the next one starts, so
+ * a chain of N per-pixel color operations streams the whole frame through memory N times --
+ * with long grading chains, bandwidth dominates arithmetic. Those chains are fusable: a run of
+ * operations that (a) are per-pixel (`flags_.can_be_constant`-style locality: output pixel
+ * depends only on the same input pixel), (b) have a single consumer, and (c) share a canvas, can
+ * execute as one composite loop that applies each operation's `update_memory_buffer_partial` to
+ * a tile-sized scratch buffer held in cache, materializing only the chain's final output.
+ * Detection belongs in the compile step (`COM_NodeOperationBuilder`), which already knows the
+ * consumer counts; execution fits this model unchanged since a fused chain presents as a single
+ * operation here. Operations with spatial access (blur, transform) break the chain and keep
+ * full-frame semantics. */
 void FullFrameExecutionModel::render_operations()
 {
   const bool is_rendering = context_.is_rendering();
@@ -239,6 +239,16 @@ static void fht_convolve(fREAL *d1, const fREAL *d2, uint M, uint N)
 }
 //------------------------------------------------------------------------------
 
+/* NOTE: Fog glow is already frequency-domain (the Hartley transform above), but the transform is
+ * single-threaded, the rows/columns loops in #FHT2D don't parallelize over scan-lines, and the
+ * kernel spectrum is recomputed every execution even though it only depends on the quality
+ * setting. Meanwhile large-radius bokeh blur and custom-kernel convolve remain spatial-domain and
+ * quadratic in radius. The shared fix is one convolution service in COM_algorithms (CPU via a
+ * threaded real-to-complex transform with per-size cached kernel spectra, GPU via compute-shader
+ * Stockham passes for the realtime backend) that this operation, #BokehBlurOperation and the
+ * Convolve path all call instead of owning their own math. Keeping results matching the spatial
+ * path at tile seams requires full-image transforms, not the per-block loop used below, so the
+ * service needs the whole input -- fine here since glare already forces full-frame. */
 static void convolve(float *dst, MemoryBuffer *in1, MemoryBuffer *in2)
 {
   fREAL *data1, *data2, *fp;
@@ -236,6 +236,17 @@ std::unique_ptr<MetaData> RenderLayersProg::get_meta_data()
   return std::move(callback_data.meta_data);
 }
 
+/* NOTE: This copy is the last duplication left on the render-result path. Pass storage is
+ * already ImBuf-backed with implicit sharing (#RE_pass_set_buffer_data), and the image editor
+ * references the result's ImBuf directly under the viewer lock rather than copying -- but here
+ * every compositor execution still materializes each read pass into a fresh #MemoryBuffer,
+ * which for multi-AOV 4K results re-buffers gigabytes per frame. The zero-copy form is to make
+ * this operation's rendered buffer a MemoryBuffer wrapping the pass data (the wrapping
+ * constructor already exists and is used for input views), holding a user on the ImBuf's
+ * implicit-sharing handle for the execution's lifetime. The blocker is lifetime, not plumbing:
+ * the wrap must pin the buffer across the whole graph execution while render slots can be
+ * cleared or re-rendered concurrently, so the acquire in execute_region()'s current
+ * RE_AcquireResultRead scope has to widen to operation lifetime first. */
 void RenderLayersProg::update_memory_buffer_partial(MemoryBuffer *output,
                                                     const rcti &area,
                                                     Span<MemoryBuffer *> /*inputs*/)
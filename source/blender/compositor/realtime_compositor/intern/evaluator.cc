@@ -25,6 +25,17 @@ using namespace nodes::derived_node_tree_types;
 
 Evaluator::Evaluator(Context &context) : context_(context) {}
 
+/* NOTE: Once compiled, every evaluation re-runs the full operations stream even when a
+ * sub-graph's inputs are static across frames (file-loaded masks, single-frame renders), so
+ * playback pays for the whole graph when only the time-varying branch changed. The cross-frame
+ * cache infrastructure for this already exists in #StaticCacheManager, which keeps resources
+ * alive as long as they are requested each evaluation; what is missing is a result-level entry:
+ * a cached-result container keyed by a hash of an operation's input results and node parameters,
+ * consulted in Operation::evaluate() before executing, with upstream operations skipped when
+ * every consumer hit the cache. The hard part is the key -- parameter hashing per node type and
+ * a cheap content identity for input results (GPU textures can't be hashed per frame, so
+ * identity must propagate from source operations: scene frame for movies, nothing for static
+ * images). That propagation channel through #Result is the prerequisite to build first. */
 void Evaluator::evaluate()
 {
   context_.cache_manager().reset();
@@ -50,6 +50,17 @@ void DEG_debug_stats_gnuplot(const Depsgraph *graph,
                              const char *label,
                              const char *output_filename);
 
+/**
+ * Write per-operation timings of the most recent graph evaluations in a CSV format.
+ *
+ * Each retained evaluation starts with a comment line denoting its update count and scene frame,
+ * followed by one `start_time,duration,thread_id,operation` line per evaluated operation. Times
+ * are in seconds, relative to the begin of the corresponding graph evaluation.
+ *
+ * Timings are only recorded when depsgraph time debug (`--debug-depsgraph-time`) is enabled.
+ */
+void DEG_debug_stats_timings(const Depsgraph *graph, FILE *fp);
+
 /* ************************************************ */
 
 /** Compare two dependency graphs. */
@@ -97,7 +97,12 @@ void animated_property_cb(ID * /*id*/, FCurve *fcurve, void *data_v)
 
 }  // namespace
 
-AnimatedPropertyStorage::AnimatedPropertyStorage() : is_fully_initialized(false) {}
+AnimatedPropertyStorage::AnimatedPropertyStorage(LinearAllocator<> &allocator)
+    : is_fully_initialized(false),
+      animated_objects_set(allocator),
+      animated_properties_set(allocator)
+{
+}
 
 void AnimatedPropertyStorage::initializeFromID(DepsgraphBuilderCache *builder_cache, const ID *id)
 {
@@ -149,7 +154,7 @@ DepsgraphBuilderCache::~DepsgraphBuilderCache()
 AnimatedPropertyStorage *DepsgraphBuilderCache::ensureAnimatedPropertyStorage(const ID *id)
 {
   return animated_property_storage_map_.lookup_or_add_cb(
-      id, []() { return new AnimatedPropertyStorage(); });
+      id, [&]() { return new AnimatedPropertyStorage(allocator_); });
 }
 
 AnimatedPropertyStorage *DepsgraphBuilderCache::ensureInitializedAnimatedPropertyStorage(
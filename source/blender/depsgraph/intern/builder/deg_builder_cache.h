@@ -10,6 +10,8 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "BLI_linear_allocator.hh"
+
 #include "intern/depsgraph_type.hh"
 
 #include "RNA_access.hh"
@@ -22,6 +24,20 @@ namespace blender::deg {
 
 class DepsgraphBuilderCache;
 
+/**
+ * Set whose storage lives in the builder cache's linear allocator. A build creates one such set
+ * per animated data-block with many transient entries; batching the storage in the allocator
+ * avoids malloc traffic and frees everything in one go with the cache.
+ */
+template<typename Key>
+using BuilderCacheSet = Set<Key,
+                            default_inline_buffer_capacity(sizeof(Key)),
+                            DefaultProbingStrategy,
+                            DefaultHash<Key>,
+                            DefaultEquality<Key>,
+                            typename DefaultSetSlot<Key>::type,
+                            LinearContainerAllocator<>>;
+
 /* Identifier for animated property. */
 class AnimatedPropertyID {
  public:
@@ -43,7 +59,7 @@ class AnimatedPropertyID {
 
 class AnimatedPropertyStorage {
  public:
-  AnimatedPropertyStorage();
+  AnimatedPropertyStorage(LinearAllocator<> &allocator);
 
   void initializeFromID(DepsgraphBuilderCache *builder_cache, const ID *id);
 
@@ -59,8 +75,8 @@ class AnimatedPropertyStorage {
   bool is_fully_initialized;
 
   /* indexed by PointerRNA.data. */
-  Set<const void *> animated_objects_set;
-  Set<AnimatedPropertyID> animated_properties_set;
+  BuilderCacheSet<const void *> animated_objects_set;
+  BuilderCacheSet<AnimatedPropertyID> animated_properties_set;
 
   MEM_CXX_CLASS_ALLOC_FUNCS("AnimatedPropertyStorage");
 };
@@ -98,6 +114,10 @@ class DepsgraphBuilderCache {
 
   Map<const ID *, AnimatedPropertyStorage *> animated_property_storage_map_;
 
+  /* Backs the hash storage of all animated property sets, released as a whole when the cache is
+   * destructed (the storages themselves are deleted in the destructor body, before this). */
+  LinearAllocator<> allocator_;
+
   MEM_CXX_CLASS_ALLOC_FUNCS("DepsgraphBuilderCache");
 };
 
@@ -18,6 +18,7 @@
 #include "BKE_global.h"
 
 #include "intern/depsgraph.hh"
+#include "intern/node/deg_node_operation.hh"
 
 namespace blender::deg {
 
@@ -56,6 +57,35 @@ void DepsgraphDebug::end_graph_evaluation()
   }
 }
 
+void DepsgraphDebug::record_operation_timings(const Depsgraph *graph)
+{
+  if (!do_time_debug()) {
+    return;
+  }
+
+  EvaluationTimings timings;
+  timings.update_count = graph->update_count;
+  timings.frame = graph->frame;
+
+  for (const OperationNode *node : graph->operations) {
+    /* Operations which were not evaluated during this graph evaluation have no start time. */
+    if (node->stats.current_start_time == 0.0) {
+      continue;
+    }
+    OperationTimingSample sample;
+    sample.full_identifier = node->full_identifier();
+    sample.start_time = node->stats.current_start_time - graph_evaluation_start_time_;
+    sample.duration = node->stats.current_time;
+    sample.thread_id = node->stats.current_thread_id;
+    timings.samples.append(std::move(sample));
+  }
+
+  if (timings_history.size() == MAX_TIMINGS_HISTORY) {
+    timings_history.remove(0);
+  }
+  timings_history.append(std::move(timings));
+}
+
 bool terminal_do_color()
 {
   return (G.debug & G_DEBUG_DEPSGRAPH_PRETTY) != 0;
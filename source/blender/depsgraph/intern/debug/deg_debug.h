@@ -16,6 +16,32 @@
 
 namespace blender::deg {
 
+struct Depsgraph;
+
+/* Timing of a single operation evaluation, recorded when depsgraph time debug is enabled. */
+struct OperationTimingSample {
+  /* Full identifier of the operation, including its owner names. */
+  string full_identifier;
+  /* Start of the operation evaluation in seconds, relative to the begin of the graph
+   * evaluation. */
+  double start_time;
+  /* Duration of the operation evaluation in seconds. */
+  double duration;
+  /* Identifier of the thread the operation was evaluated on. The value itself has no meaning,
+   * it is only guaranteed to be different for different threads within a single evaluation. */
+  uint64_t thread_id;
+};
+
+/* Timings of all operations evaluated during a single graph evaluation. */
+struct EvaluationTimings {
+  /* Number of times the graph was evaluated at the moment this record was taken,
+   * corresponds to DEG_get_update_count(). */
+  uint64_t update_count;
+  /* Scene frame the graph was evaluated at. */
+  float frame;
+  Vector<OperationTimingSample> samples;
+};
+
 class DepsgraphDebug {
  public:
   DepsgraphDebug();
@@ -25,6 +51,10 @@ class DepsgraphDebug {
   void begin_graph_evaluation();
   void end_graph_evaluation();
 
+  /* Store per-operation timings of the current graph evaluation in the timings history.
+   * The oldest record is discarded when the history exceeds MAX_TIMINGS_HISTORY. */
+  void record_operation_timings(const Depsgraph *graph);
+
   /* NOTE: Corresponds to G_DEBUG_DEPSGRAPH_* flags. */
   int flags;
 
@@ -32,10 +62,17 @@ class DepsgraphDebug {
    * created for different view layer). */
   string name;
 
+  /* Per-operation timings of the most recent graph evaluations, oldest first.
+   * Only filled in when time debug is enabled. */
+  Vector<EvaluationTimings> timings_history;
+
  protected:
   /* Maximum number of counters used to calculate frame rate of depsgraph update. */
   static const constexpr int MAX_FPS_COUNTERS = 64;
 
+  /* Maximum number of graph evaluations to keep per-operation timings for. */
+  static const constexpr int MAX_TIMINGS_HISTORY = 8;
+
   /* Point in time when last graph evaluation began.
    * Is initialized from begin_graph_evaluation() when time debug is enabled.
    */
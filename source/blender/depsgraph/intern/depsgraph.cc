@@ -49,6 +49,7 @@ Depsgraph::Depsgraph(Main *bmain, Scene *scene, ViewLayer *view_layer, eEvaluati
       has_animated_visibility(false),
       need_update_relations(true),
       need_update_nodes_visibility(true),
+      need_update_operation_chain_lengths(true),
       need_tag_id_on_graph_visibility_update(true),
       need_tag_id_on_graph_visibility_time_update(false),
       bmain(bmain),
@@ -203,9 +204,15 @@ Relation *Depsgraph::check_nodes_connected(const Node *from,
                                            const Node *to,
                                            const char *description)
 {
-  for (Relation *rel : from->outlinks) {
-    BLI_assert(rel->from == from);
-    if (rel->to != to) {
+  /* Scan the shorter of the two relation lists. This avoids quadratic behavior during relation
+   * building when one of the nodes is a hub with many thousands of links (e.g. the animation
+   * operation of a heavily keyed ID), since the node on the other end of a candidate relation
+   * typically has only a handful of links. */
+  const bool scan_outlinks = from->outlinks.size() <= to->inlinks.size();
+  const Node::Relations &links = scan_outlinks ? from->outlinks : to->inlinks;
+  for (Relation *rel : links) {
+    BLI_assert(scan_outlinks ? rel->from == from : rel->to == to);
+    if (scan_outlinks ? (rel->to != to) : (rel->from != from)) {
       continue;
     }
     if (description != nullptr && !STREQ(rel->name, description)) {
@@ -99,6 +99,10 @@ struct Depsgraph {
   /* Indicates whether indirect effect of nodes on a directly visible ones needs to be updated. */
   bool need_update_nodes_visibility;
 
+  /* Indicates whether the scheduling priority of operation nodes needs to be re-calculated.
+   * Set whenever the set of operations or relations changes. */
+  bool need_update_operation_chain_lengths;
+
   /* Indicated whether IDs in this graph are to be tagged as if they first appear visible, with
    * an optional tag for their animation (time) update. */
   bool need_tag_id_on_graph_visibility_update;
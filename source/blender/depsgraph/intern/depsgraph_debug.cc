@@ -224,6 +224,27 @@ void DEG_stats_simple(const Depsgraph *graph,
   }
 }
 
+void DEG_debug_stats_timings(const Depsgraph *graph, FILE *fp)
+{
+  const deg::Depsgraph *deg_graph = reinterpret_cast<const deg::Depsgraph *>(graph);
+
+  for (const deg::EvaluationTimings &timings : deg_graph->debug.timings_history) {
+    fprintf(fp,
+            "# evaluation %" PRIu64 " frame %f\n",
+            uint64_t(timings.update_count),
+            double(timings.frame));
+    fprintf(fp, "start_time,duration,thread_id,operation\n");
+    for (const deg::OperationTimingSample &sample : timings.samples) {
+      fprintf(fp,
+              "%f,%f,%" PRIx64 ",\"%s\"\n",
+              sample.start_time,
+              sample.duration,
+              sample.thread_id,
+              sample.full_identifier.c_str());
+    }
+  }
+}
+
 static deg::string depsgraph_name_for_logging(Depsgraph *depsgraph)
 {
   const char *name = DEG_debug_name_get(depsgraph);
@@ -10,13 +10,18 @@
 
 #include "intern/eval/deg_eval.h"
 
+#include <algorithm>
+#include <thread>
+
 #include "PIL_time.h"
 
 #include "BLI_compiler_attrs.h"
 #include "BLI_function_ref.hh"
 #include "BLI_gsqueue.h"
+#include "BLI_profile.hh"
 #include "BLI_task.h"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #include "BKE_global.h"
 
@@ -97,6 +102,9 @@ void evaluate_node(const DepsgraphEvalState *state, OperationNode *operation_nod
     const double start_time = PIL_check_seconds_timer();
     operation_node->evaluate(depsgraph);
     operation_node->stats.current_time += PIL_check_seconds_timer() - start_time;
+    operation_node->stats.current_start_time = start_time;
+    operation_node->stats.current_thread_id = uint64_t(
+        std::hash<std::thread::id>{}(std::this_thread::get_id()));
   }
   else {
     operation_node->evaluate(depsgraph);
@@ -187,6 +195,61 @@ void calculate_pending_parents_if_needed(DepsgraphEvalState *state)
   state->need_update_pending_parents = false;
 }
 
+/* Calculate the number of operations on the longest outgoing chain of every operation.
+ *
+ * The chain length is used as a scheduling priority: operations with a long chain of dependent
+ * operations are to be evaluated first, as they are the ones which define the critical path of
+ * the graph evaluation. Without such prioritization a worker thread can pick up a trivial leaf
+ * operation while the long rig evaluation chain only starts towards the end of the evaluation,
+ * increasing the overall wall time.
+ *
+ * The lengths only depend on the graph topology, so they are calculated once after the graph is
+ * (re)built and are re-used by all subsequent evaluations. */
+void calculate_operation_chain_lengths_if_needed(DepsgraphEvalState *state)
+{
+  Depsgraph *graph = state->graph;
+  if (!graph->need_update_operation_chain_lengths) {
+    return;
+  }
+  /* The pending parents counter is used as a scratch storage for the number of outgoing links
+   * which is needed for the reversed topological traversal. This is safe because the counter is
+   * always re-calculated prior to any scheduling. */
+  BLI_assert(state->need_update_pending_parents);
+  for (OperationNode *node : graph->operations) {
+    node->chain_length = 1;
+    uint32_t num_outgoing_links = 0;
+    for (const Relation *rel : node->outlinks) {
+      if ((rel->flag & RELATION_FLAG_CYCLIC) == 0) {
+        ++num_outgoing_links;
+      }
+    }
+    node->num_links_pending = num_outgoing_links;
+  }
+  /* Traverse operations in the reversed topological order, propagating chain lengths from the
+   * leaves towards the entry points of the graph. */
+  Vector<OperationNode *> queue;
+  for (OperationNode *node : graph->operations) {
+    if (node->num_links_pending == 0) {
+      queue.append(node);
+    }
+  }
+  while (!queue.is_empty()) {
+    const OperationNode *node = queue.pop_last();
+    for (const Relation *rel : node->inlinks) {
+      if (rel->from->type != NodeType::OPERATION || (rel->flag & RELATION_FLAG_CYCLIC) != 0) {
+        continue;
+      }
+      OperationNode *parent = (OperationNode *)rel->from;
+      parent->chain_length = std::max(parent->chain_length, node->chain_length + 1);
+      BLI_assert(parent->num_links_pending > 0);
+      if (--parent->num_links_pending == 0) {
+        queue.append(parent);
+      }
+    }
+  }
+  graph->need_update_operation_chain_lengths = false;
+}
+
 void initialize_execution(DepsgraphEvalState *state, Depsgraph *graph)
 {
   /* Clear tags and other things which needs to be clear. */
@@ -316,11 +379,23 @@ void evaluate_graph_threaded_stage(DepsgraphEvalState *state,
 {
   state->stage = stage;
 
+  calculate_operation_chain_lengths_if_needed(state);
   calculate_pending_parents_if_needed(state);
 
-  schedule_graph(state, [&](OperationNode *node) {
+  /* Push the initial batch of ready operations longest-chain-first, so that worker threads start
+   * from the operations with the most work depending on them. The scheduling order of the rest of
+   * the operations follows the completion order of their parents, which stays close to the
+   * desired priority order in practice. */
+  Vector<OperationNode *> ready_nodes;
+  schedule_graph(state, [&](OperationNode *node) { ready_nodes.append(node); });
+  std::stable_sort(ready_nodes.begin(),
+                   ready_nodes.end(),
+                   [](const OperationNode *a, const OperationNode *b) {
+                     return a->chain_length > b->chain_length;
+                   });
+  for (OperationNode *node : ready_nodes) {
     BLI_task_pool_push(task_pool, deg_task_run_func, node, false, nullptr);
-  });
+  }
   BLI_task_pool_work_and_wait(task_pool);
 }
 
@@ -389,6 +464,8 @@ void deg_evaluate_on_refresh(Depsgraph *graph)
 
   graph->update_count++;
 
+  BLI_PROFILE_SCOPE("Depsgraph Evaluation", "depsgraph");
+
   graph->debug.begin_graph_evaluation();
 
 #ifdef WITH_PYTHON
@@ -456,6 +533,7 @@ void deg_evaluate_on_refresh(Depsgraph *graph)
    * synchronization. */
   if (state.do_stats) {
     deg_eval_stats_aggregate(graph);
+    graph->debug.record_operation_timings(graph);
   }
 
   /* Clear any uncleared tags. */
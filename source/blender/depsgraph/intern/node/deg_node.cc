@@ -269,12 +269,14 @@ Node::Stats::Stats()
 
 void Node::Stats::reset()
 {
-  current_time = 0.0;
+  reset_current();
 }
 
 void Node::Stats::reset_current()
 {
   current_time = 0.0;
+  current_start_time = 0.0;
+  current_thread_id = 0;
 }
 
 /*******************************************************************************
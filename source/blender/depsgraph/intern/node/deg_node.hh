@@ -164,6 +164,11 @@ struct Node {
     void reset_current();
     /* Time spent on this node during current graph evaluation. */
     double current_time;
+    /* Point in time (as reported by PIL_check_seconds_timer()) when evaluation of this node
+     * started during the current graph evaluation, and an identifier of the thread it was
+     * evaluated on. Only filled in for operation nodes. */
+    double current_start_time;
+    uint64_t current_thread_id;
   };
   /* Relationships between nodes
    * The reason why all depsgraph nodes are descended from this type (apart
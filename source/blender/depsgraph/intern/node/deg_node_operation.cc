@@ -205,7 +205,10 @@ const char *operationCodeAsString(OperationCode opcode)
   return "UNKNOWN";
 }
 
-OperationNode::OperationNode() : name_tag(-1), flag(0) {}
+OperationNode::OperationNode()
+    : num_links_pending(0), scheduled(false), chain_length(0), name_tag(-1), flag(0)
+{
+}
 
 string OperationNode::identifier() const
 {
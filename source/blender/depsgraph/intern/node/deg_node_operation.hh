@@ -275,6 +275,11 @@ struct OperationNode : public Node {
   uint32_t num_links_pending;
   bool scheduled;
 
+  /* Number of operations on the longest chain which starts at this operation, used as a
+   * scheduling priority: the longer the chain the sooner the operation is to be evaluated.
+   * Calculated by the evaluation code after the graph is (re)built. */
+  uint32_t chain_length;
+
   /* Identifier for the operation being performed. */
   OperationCode opcode;
   int name_tag;
@@ -15,6 +15,7 @@
 #include "BLI_set.hh"
 #include "BLI_span.hh"
 #include "BLI_struct_equality_utils.hh"
+#include "BLI_utildefines.h"
 #include "BLI_virtual_array.hh"
 
 #include "DNA_customdata_types.h"
@@ -55,6 +56,22 @@ enum class CustomRequest : int8_t {
 
 using AttributeRequest = std::variant<CustomRequest, GenericRequest>;
 
+/**
+ * Which parts of a node's vertex buffers changed since the last update. #node_update skips
+ * re-extracting and re-uploading buffers outside the scope, which keeps brush strokes that only
+ * displace vertices from re-uploading masks, face sets and generic attribute layers.
+ */
+enum class UpdateScope : uint8_t {
+  /** Vertex positions, including the normals derived from them. */
+  Positions = 1 << 0,
+  Mask = 1 << 1,
+  FaceSets = 1 << 2,
+  /** Color and other generic attribute layers. */
+  Attributes = 1 << 3,
+  All = Positions | Mask | FaceSets | Attributes,
+};
+ENUM_OPERATORS(UpdateScope, UpdateScope::Attributes);
+
 struct PBVHBatches;
 
 struct PBVH_GPU_Args {
@@ -94,7 +111,7 @@ struct PBVH_GPU_Args {
   int cd_mask_layer;
 };
 
-void node_update(PBVHBatches *batches, const PBVH_GPU_Args &args);
+void node_update(PBVHBatches *batches, const PBVH_GPU_Args &args, UpdateScope scope);
 void update_pre(PBVHBatches *batches, const PBVH_GPU_Args &args);
 
 void node_gpu_flush(PBVHBatches *batches);
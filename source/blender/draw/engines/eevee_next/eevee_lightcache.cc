@@ -43,6 +43,18 @@
 
 namespace blender::eevee {
 
+/**
+ * \note Probe baking here is already background-capable in the way the legacy light cache was
+ * not: the job runs in a worker thread against its own render depsgraph (created below, never
+ * the viewport's), and partial grid results stream back to the original objects through
+ * #update() as bricks complete, so the viewport refreshes incrementally during the bake. The
+ * parts that still get in the artists' way are around the edges: on platforms where
+ * #GPU_use_main_context_workaround() is true the worker serializes against the main GPU context
+ * and every dispatch stalls the UI; the `delay_ms_` start delay papers over that instead of
+ * yielding between probe batches; and edits made during a long bake are not picked up -- the
+ * bake depsgraph is evaluated once at start, where re-tagging it and restarting only the
+ * affected grids would make look-dev iteration continuous.
+ */
 class LightBake {
  private:
   Depsgraph *depsgraph_;
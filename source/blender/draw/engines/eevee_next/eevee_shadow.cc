@@ -1053,7 +1053,18 @@ void ShadowModule::end_sync()
         sub.barrier(GPU_BARRIER_SHADER_STORAGE);
       }
       {
-        /* Mark for update all shadow pages touching an updated shadow caster. */
+        /* Mark for update all shadow pages touching an updated shadow caster.
+         *
+         * NOTE: Tile-granular invalidation already happens here (updated caster bounds are
+         * intersected against tiles on GPU) and unchanged pages persist through the cached page
+         * heap, so during camera-only navigation local lights mostly keep their pages. What
+         * still discards everything is `do_full_update`, raised whenever the atlas or the
+         * tile-map buffer is resized -- growing one light's allocation re-renders every page of
+         * every light. Retention across those events needs the resize paths to copy surviving
+         * pages into the new allocation (the atlas is layer-compatible between sizes) instead of
+         * re-initializing the heaps. The other repeated cost is this tagging dispatch itself:
+         * it runs per updated caster over all tile-maps each frame, where a coarse caster/light
+         * bounds pre-pass on CPU would cut the dispatch to intersecting tile-maps only. */
         PassSimple::Sub &sub = pass.sub("CasterUpdate");
         sub.shader_set(inst_.shaders.static_shader_get(SHADOW_TILEMAP_TAG_UPDATE));
         sub.bind_ssbo("tilemaps_buf", tilemap_pool.tilemaps_data);
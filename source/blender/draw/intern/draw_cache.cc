@@ -2899,6 +2899,14 @@ GPUBatch *DRW_cache_mesh_edge_detection_get(Object *ob, bool *r_is_manifold)
   return DRW_mesh_batch_cache_get_edge_detection(static_cast<Mesh *>(ob->data), r_is_manifold);
 }
 
+/**
+ * \note This always returns the full-resolution surface batch. Automatic viewport LOD (e.g.
+ * swapping in decimated geometry for objects with small screen coverage) cannot be decided at
+ * this level: batches are shared by all viewports and engines, so a per-view swap would need
+ * per-view batch storage, and a decimation chain would have to be kept in sync with every
+ * evaluated mesh the modifier stack produces. Per-view geometry reduction belongs in the engines
+ * (as done for subdivision levels), not in the shared cache lookup.
+ */
 GPUBatch *DRW_cache_mesh_surface_get(Object *ob)
 {
   BLI_assert(ob->type == OB_MESH);
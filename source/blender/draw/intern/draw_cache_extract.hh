@@ -240,6 +240,15 @@ struct MeshBufferCache {
                  &batch_cache.cage : \
                  ((mbc == &batch_cache.cage) ? &batch_cache.uv_cage : nullptr))
 
+/**
+ * GPU buffers and batches for drawing one mesh, stored in #Mesh::runtime.
+ *
+ * Note that the cache lives and dies with its mesh: when a modifier stack outputs a new evaluated
+ * mesh (every frame of an animated character, for example), all buffers are extracted again even
+ * if only positions changed. Keeping index buffers alive across deform-only updates would require
+ * tracking topology identity between different evaluated mesh instances, which the cache has no
+ * way to do at this level.
+ */
 struct MeshBatchCache {
   MeshBufferCache final, cage, uv_cage;
 
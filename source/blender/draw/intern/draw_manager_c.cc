@@ -1643,6 +1643,14 @@ void DRW_draw_view(const bContext *C)
   }
 }
 
+/**
+ * \note This is the legacy submission path: engines using #DRWShadingGroup issue one draw per
+ * object, so scenes with very many small objects are CPU submission bound here. The replacement
+ * is the new #draw::Manager pipeline (`draw_command.hh`), which merges instances of the same
+ * batch into multi-draw-indirect commands and culls them with the `draw_visibility` compute
+ * shader on the GPU. Engines get the GPU-driven behavior by porting to it, not by extending
+ * this loop.
+ */
 void DRW_draw_render_loop_ex(Depsgraph *depsgraph,
                              RenderEngineType *engine_type,
                              ARegion *region,
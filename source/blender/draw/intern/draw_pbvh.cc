@@ -779,13 +779,32 @@ struct PBVHBatches {
     }
   }
 
-  void update(const PBVH_GPU_Args &args)
+  static bool request_in_scope(const AttributeRequest &request, const UpdateScope scope)
+  {
+    if (const CustomRequest *request_type = std::get_if<CustomRequest>(&request)) {
+      switch (*request_type) {
+        case CustomRequest::Position:
+        case CustomRequest::Normal:
+          return bool(scope & UpdateScope::Positions);
+        case CustomRequest::Mask:
+          return bool(scope & UpdateScope::Mask);
+        case CustomRequest::FaceSet:
+          return bool(scope & UpdateScope::FaceSets);
+      }
+      return true;
+    }
+    return bool(scope & UpdateScope::Attributes);
+  }
+
+  void update(const PBVH_GPU_Args &args, const UpdateScope scope)
   {
     if (!lines_index) {
       create_index(args);
     }
     for (PBVHVbo &vbo : vbos) {
-      fill_vbo(vbo, args);
+      if (request_in_scope(vbo.request, scope)) {
+        fill_vbo(vbo, args);
+      }
     }
   }
 
@@ -1356,9 +1375,9 @@ struct PBVHBatches {
   }
 };
 
-void node_update(PBVHBatches *batches, const PBVH_GPU_Args &args)
+void node_update(PBVHBatches *batches, const PBVH_GPU_Args &args, const UpdateScope scope)
 {
-  batches->update(args);
+  batches->update(args, scope);
 }
 
 void node_gpu_flush(PBVHBatches *batches)
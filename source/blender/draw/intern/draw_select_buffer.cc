@@ -53,6 +53,16 @@ bool SELECTID_Context::is_dirty(RegionView3D *rv3d)
 /** \name Buffer of select ID's
  * \{ */
 
+/* NOTE: The select-ID buffer is already persistent -- `is_dirty` re-renders only when the view
+ * or an object changed, not per click -- so the per-drag-step stall on dense meshes is the
+ * synchronous `GPU_framebuffer_read_color` below, which drains the whole GPU pipeline before
+ * returning. For box/lasso *preview*, exactness per step is not required: the readback can go
+ * through a small ring of PBO-backed async reads, with the caller consuming the most recent
+ * completed frame's IDs (one step of latency is invisible while the marquee is moving), and
+ * only the final confirm doing today's blocking read against the current frame. That split
+ * belongs in the callers' drag loops; this function stays the exact synchronous primitive, and
+ * an async variant returning a completion handle beside it keeps the two semantics from being
+ * mixed up. */
 uint *DRW_select_buffer_read(
     Depsgraph *depsgraph, ARegion *region, View3D *v3d, const rcti *rect, uint *r_buf_len)
 {
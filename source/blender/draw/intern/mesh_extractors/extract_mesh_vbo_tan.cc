@@ -9,6 +9,7 @@
 #include "MEM_guardedalloc.h"
 
 #include "BLI_string.h"
+#include "BLI_task.hh"
 
 #include "BKE_editmesh.hh"
 #include "BKE_editmesh_tangent.hh"
@@ -190,26 +191,32 @@ static void extract_tan_ex_init(const MeshRenderData &mr,
   GPU_vertbuf_init_with_format(vbo, &format);
   GPU_vertbuf_data_alloc(vbo, v_len);
 
+  /* The format is de-interleaved, so every layer occupies a contiguous slice of the VBO and the
+   * packing of each corner is independent, which allows converting in parallel. */
   if (do_hq) {
     short(*tan_data)[4] = (short(*)[4])GPU_vertbuf_get_data(vbo);
     for (int i = 0; i < tan_len; i++) {
       const char *name = tangent_names[i];
       const float(*layer_data)[4] = (const float(*)[4])CustomData_get_layer_named(
           &corner_data, CD_TANGENT, name);
-      for (int ml_index = 0; ml_index < mr.loop_len; ml_index++) {
-        normal_float_to_short_v3(*tan_data, layer_data[ml_index]);
-        (*tan_data)[3] = (layer_data[ml_index][3] > 0.0f) ? SHRT_MAX : SHRT_MIN;
-        tan_data++;
-      }
+      short(*layer_tan_data)[4] = tan_data + i * mr.loop_len;
+      threading::parallel_for(IndexRange(mr.loop_len), 4096, [&](const IndexRange range) {
+        for (const int ml_index : range) {
+          normal_float_to_short_v3(layer_tan_data[ml_index], layer_data[ml_index]);
+          layer_tan_data[ml_index][3] = (layer_data[ml_index][3] > 0.0f) ? SHRT_MAX : SHRT_MIN;
+        }
+      });
     }
     if (use_orco_tan) {
       const float(*layer_data)[4] = (const float(*)[4])CustomData_get_layer_n(
           &corner_data, CD_TANGENT, 0);
-      for (int ml_index = 0; ml_index < mr.loop_len; ml_index++) {
-        normal_float_to_short_v3(*tan_data, layer_data[ml_index]);
-        (*tan_data)[3] = (layer_data[ml_index][3] > 0.0f) ? SHRT_MAX : SHRT_MIN;
-        tan_data++;
-      }
+      short(*layer_tan_data)[4] = tan_data + tan_len * mr.loop_len;
+      threading::parallel_for(IndexRange(mr.loop_len), 4096, [&](const IndexRange range) {
+        for (const int ml_index : range) {
+          normal_float_to_short_v3(layer_tan_data[ml_index], layer_data[ml_index]);
+          layer_tan_data[ml_index][3] = (layer_data[ml_index][3] > 0.0f) ? SHRT_MAX : SHRT_MIN;
+        }
+      });
     }
   }
   else {
@@ -218,20 +225,24 @@ static void extract_tan_ex_init(const MeshRenderData &mr,
       const char *name = tangent_names[i];
       const float(*layer_data)[4] = (const float(*)[4])CustomData_get_layer_named(
           &corner_data, CD_TANGENT, name);
-      for (int ml_index = 0; ml_index < mr.loop_len; ml_index++) {
-        *tan_data = GPU_normal_convert_i10_v3(layer_data[ml_index]);
-        tan_data->w = (layer_data[ml_index][3] > 0.0f) ? 1 : -2;
-        tan_data++;
-      }
+      GPUPackedNormal *layer_tan_data = tan_data + i * mr.loop_len;
+      threading::parallel_for(IndexRange(mr.loop_len), 4096, [&](const IndexRange range) {
+        for (const int ml_index : range) {
+          layer_tan_data[ml_index] = GPU_normal_convert_i10_v3(layer_data[ml_index]);
+          layer_tan_data[ml_index].w = (layer_data[ml_index][3] > 0.0f) ? 1 : -2;
+        }
+      });
     }
     if (use_orco_tan) {
       const float(*layer_data)[4] = (const float(*)[4])CustomData_get_layer_n(
           &corner_data, CD_TANGENT, 0);
-      for (int ml_index = 0; ml_index < mr.loop_len; ml_index++) {
-        *tan_data = GPU_normal_convert_i10_v3(layer_data[ml_index]);
-        tan_data->w = (layer_data[ml_index][3] > 0.0f) ? 1 : -2;
-        tan_data++;
-      }
+      GPUPackedNormal *layer_tan_data = tan_data + tan_len * mr.loop_len;
+      threading::parallel_for(IndexRange(mr.loop_len), 4096, [&](const IndexRange range) {
+        for (const int ml_index : range) {
+          layer_tan_data[ml_index] = GPU_normal_convert_i10_v3(layer_data[ml_index]);
+          layer_tan_data[ml_index].w = (layer_data[ml_index][3] > 0.0f) ? 1 : -2;
+        }
+      });
     }
   }
 
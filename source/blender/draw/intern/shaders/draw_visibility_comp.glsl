@@ -5,7 +5,16 @@
 /**
  * Compute visibility of each resource bounds for a given view.
  */
-/* TODO(fclem): This could be augmented by a 2 pass occlusion culling system. */
+/* TODO(fclem): This could be augmented by a 2 pass occlusion culling system:
+ * - Pass 1 tests each bounds' closest corner against a Hi-Z pyramid built from the previous
+ *   frame's depth (see `eevee_hizbuffer.cc` for the down-sampling pass), drawing only the
+ *   resources that were visible last frame.
+ * - Pass 2 re-tests the rejected bounds against a pyramid rebuilt from the pass 1 depth and
+ *   draws the false negatives, so disocclusions and camera cuts stay artifact free.
+ * The pyramid would live next to the view (it is per depth buffer, not per engine) so that
+ * workbench and overlay get the same culling without their own infrastructure. Engines with a
+ * custom visibility pass (e.g. workbench `ShadowView`) keep overriding
+ * `View::compute_visibility` as they do now. */
 
 #pragma BLENDER_REQUIRE(common_view_lib.glsl)
 #pragma BLENDER_REQUIRE(common_math_lib.glsl)
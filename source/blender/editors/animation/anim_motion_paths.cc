@@ -486,6 +486,16 @@ void animviz_calc_motionpaths(Depsgraph *depsgraph,
   }
 
   /* calculate path over requested range */
+  /* NOTE: This loop steps the caller's depsgraph frame by frame on the main thread, so a full
+   * path refresh over a long range freezes the UI for its duration. Frames are independent here
+   * -- each iteration writes only its own `bMotionPath` points (see
+   * #motionpaths_calc_bake_targets) -- so the bake parallelizes once each worker owns its own
+   * graph: a private depsgraph restricted to the targets (the TODO above this function) copied
+   * per worker, a sub-range of frames per worker, and results streamed into the pre-allocated
+   * point ranges as they complete so the viewport shows paths filling in. Memory is the
+   * trade-off: one depsgraph copy per worker, which is why the target-restricted graph is the
+   * prerequisite rather than an optimization -- copying the full scene graph per worker would
+   * be prohibitive on heavy shots. */
   CLOG_INFO(&LOG,
             1,
             "Calculating MotionPaths between frames %d - %d (%d frames)",
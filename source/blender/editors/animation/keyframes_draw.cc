@@ -592,6 +592,21 @@ static void channel_list_draw(ChannelDrawList *channel_list, View2D *v2d)
   channel_list_draw_keys(channel_list, v2d);
 }
 
+/* NOTE: Key drawing itself is already one batch — every visible key of every channel goes into a
+ * single GPU_PRIM_POINTS draw above — so on mocap-dense files the frame cost is the CPU side:
+ * channel_list_build_keylists() rebuilds each channel's ActKeyColumn tree from the F-Curves on
+ * every redraw, including pure pans and selection changes. Two fixes, independent:
+ *
+ * - Keylist caching. Keylists are range-clipped to the view, so a cached list is reusable while
+ *   the view range is contained in the cached range and the underlying curves are unchanged.
+ *   There is no per-FCurve version counter to key on; the practical invalidation is the owning
+ *   ID's recalc tags plus select/edit flags, with the cache living on the channel (bAnimListElem
+ *   lifetime is per-redraw, so it has to hang off the F-Curve or the action).
+ *
+ * - Pixel-column decimation. Column merging already collapses keys on the same frame; when many
+ *   frames map to one pixel the emit loop in draw_channel_keys() can OR together columns sharing
+ *   a pixel X (selection and key-type flags combine the same way ActKeyColumn merging already
+ *   defines) and emit one point, bounding emitted keys by region width per channel. */
 void ED_channel_list_flush(ChannelDrawList *channel_list, View2D *v2d)
 {
   channel_list_build_keylists(channel_list, {v2d->cur.xmin, v2d->cur.xmax});
@@ -75,6 +75,16 @@ using namespace blender::bke::idprop;
  * NOTE: File browser uses name and idcode separate. Inside the index they are joined together like
  * #ID.name.
  * NOTE: File browser group name isn't stored in the index as it is a translatable name.
+ *
+ * NOTE: One JSON file per .blend does not scale to large libraries: opening the asset browser
+ * opens, parses and validates tens of thousands of small files even when nothing changed, and the
+ * parse allocates a DOM per file. The follow-up to this format is a consolidated per-library
+ * index: a single binary file of fixed-size records plus a string table, so it can be
+ * memory-mapped (see #BLI_mmap_open) and the entries used in place without a parse step, with a
+ * per-file mtime/size column so only changed .blend files are re-indexed and rewritten into it.
+ * The per-file JSON files would remain the write-side unit produced by indexing (they are cheap
+ * to update atomically); consolidation happens once per session when any of them is newer than
+ * the combined index.
  */
 constexpr StringRef ATTRIBUTE_VERSION("version");
 constexpr StringRef ATTRIBUTE_ENTRIES("entries");
@@ -1223,6 +1223,19 @@ static bool knife_bm_face_is_not_hidden(BMFace *f)
   return (BM_elem_flag_test(f, BM_ELEM_HIDDEN) == 0);
 }
 
+/* NOTE: This build is why the knife takes seconds to come up on dense meshes, and it is thrown
+ * away when the operator ends even though nothing changed: cuts are staged in the `KnifeVert` /
+ * `KnifeEdge` overlay and only applied to the BMesh on confirm, so during the whole modal
+ * interaction the triangles indexed here are static. Two consequences worth acting on: within
+ * one session, re-invoking after confirm only needs to refit/patch the regions whose faces the
+ * cut replaced (`BLI_bvhtree_update_node` plus re-inserting the new triangles beats a full
+ * rebuild for local cuts); and across tools, this private tree duplicates the edit-mesh
+ * #BMBVHTree that path-select and ray-cast utilities build from the same looptris -- a shared
+ * edit-session cache in `editmesh_bvh.cc`, invalidated from the same places that free
+ * `em->looptris`, would make knife invocation reuse whatever tree the session already paid
+ * for. The world-space coordinates used here are the obstacle: the shared tree is object-space,
+ * so sharing requires the knife to transform rays instead of vertices, which
+ * `knife_bvh_raycast` can do per-object the way snapping already does. */
 static void knife_bvh_init(KnifeTool_OpData *kcd)
 {
   Object *ob;
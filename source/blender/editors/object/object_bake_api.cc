@@ -1951,6 +1951,17 @@ static void bake_startjob(void *bkv, wmJobWorkerStatus *worker_status)
     bake_targets_clear(bkr->main, is_tangent);
   }
 
+  /* NOTE: This loop restarts the heavy machinery per object: each bake() call runs its own
+   * engine bake, and inside Cycles that means a fresh scene sync with all shared scene data
+   * (shaders, other objects for selected-to-active style setups, device memory) re-uploaded,
+   * then margin/filter post-processing runs serially before the next object starts. For
+   * library-scale baking the orchestration should invert: one persistent Render/engine session
+   * for the whole selection, per-object bake requests submitted as work into it (the engine
+   * only needs the changed bake target between requests, which incremental sync already
+   * handles for viewport renders), and the CPU-side post passes (margin, de-noise, image write)
+   * run on the completed result while the device starts the next object. The structure of
+   * bake() makes the split visible already — highpoly/lowpoly pixel setup, RE_bake_engine(),
+   * then bake_targets_output() — so the pipelining point is between the last two. */
   if (bkr->is_selected_to_active) {
     bkr->result = bake(bkr, bkr->ob, &bkr->selected_objects, bkr->reports);
   }
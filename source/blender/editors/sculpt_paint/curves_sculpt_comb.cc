@@ -97,7 +97,7 @@ struct CombOperationExecutor {
   Curves *curves_id_orig_ = nullptr;
   CurvesGeometry *curves_orig_ = nullptr;
 
-  VArray<float> point_factors_;
+  VArraySpan<float> point_factors_;
   IndexMaskMemory selected_curve_memory_;
   IndexMask curve_selection_;
 
@@ -132,8 +132,8 @@ struct CombOperationExecutor {
 
     transforms_ = CurvesSurfaceTransforms(*curves_ob_orig_, curves_id_orig_->surface);
 
-    point_factors_ = *curves_orig_->attributes().lookup_or_default<float>(
-        ".selection", bke::AttrDomain::Point, 1.0f);
+    point_factors_ = VArraySpan<float>(*curves_orig_->attributes().lookup_or_default<float>(
+        ".selection", bke::AttrDomain::Point, 1.0f));
     curve_selection_ = curves::retrieve_selected_curves(*curves_id_orig_, selected_curve_memory_);
 
     brush_pos_prev_re_ = self_->brush_pos_last_re_;
@@ -239,7 +239,7 @@ struct CurvesEffectOperationExecutor {
   Curves *curves_id_ = nullptr;
   CurvesGeometry *curves_ = nullptr;
 
-  VArray<float> curve_selection_factors_;
+  VArraySpan<float> curve_selection_factors_;
   IndexMaskMemory selected_curve_memory_;
   IndexMask curve_selection_;
 
@@ -272,8 +272,8 @@ struct CurvesEffectOperationExecutor {
       return;
     }
 
-    curve_selection_factors_ = *curves_->attributes().lookup_or_default(
-        ".selection", bke::AttrDomain::Curve, 1.0f);
+    curve_selection_factors_ = VArraySpan<float>(*curves_->attributes().lookup_or_default(
+        ".selection", bke::AttrDomain::Curve, 1.0f));
     curve_selection_ = curves::retrieve_selected_curves(*curves_id_, selected_curve_memory_);
 
     const CurvesSculpt &curves_sculpt = *ctx_.scene->toolsettings->curves_sculpt;
@@ -56,7 +56,7 @@ struct PuffOperationExecutor {
   Curves *curves_id_ = nullptr;
   CurvesGeometry *curves_ = nullptr;
 
-  VArray<float> point_factors_;
+  VArraySpan<float> point_factors_;
   IndexMaskMemory selected_curve_memory_;
   IndexMask curve_selection_;
 
@@ -104,8 +104,8 @@ struct PuffOperationExecutor {
     brush_strength_ = brush_strength_get(*ctx_.scene, *brush_, stroke_extension);
     brush_pos_re_ = stroke_extension.mouse_position;
 
-    point_factors_ = *curves_->attributes().lookup_or_default<float>(
-        ".selection", bke::AttrDomain::Point, 1.0f);
+    point_factors_ = VArraySpan<float>(*curves_->attributes().lookup_or_default<float>(
+        ".selection", bke::AttrDomain::Point, 1.0f));
     curve_selection_ = curves::retrieve_selected_curves(*curves_id_, selected_curve_memory_);
 
     falloff_shape_ = static_cast<eBrushFalloffShape>(brush_->falloff_shape);
@@ -110,7 +110,7 @@ struct SlideOperationExecutor {
   VArraySpan<float2> surface_uv_map_eval_;
   BVHTreeFromMesh surface_bvh_eval_;
 
-  VArray<float> curve_factors_;
+  VArraySpan<float> curve_factors_;
   IndexMaskMemory selected_curve_memory_;
   IndexMask curve_selection_;
 
@@ -155,8 +155,8 @@ struct SlideOperationExecutor {
     brush_radius_factor_ = brush_radius_factor(*brush_, stroke_extension);
     brush_strength_ = brush_strength_get(*ctx_.scene, *brush_, stroke_extension);
 
-    curve_factors_ = *curves_orig_->attributes().lookup_or_default(
-        ".selection", bke::AttrDomain::Curve, 1.0f);
+    curve_factors_ = VArraySpan<float>(*curves_orig_->attributes().lookup_or_default(
+        ".selection", bke::AttrDomain::Curve, 1.0f));
     curve_selection_ = curves::retrieve_selected_curves(*curves_id_orig_, selected_curve_memory_);
 
     brush_pos_re_ = stroke_extension.mouse_position;
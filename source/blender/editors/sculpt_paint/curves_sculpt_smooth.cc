@@ -45,7 +45,7 @@ struct SmoothOperationExecutor {
   Curves *curves_id_ = nullptr;
   CurvesGeometry *curves_ = nullptr;
 
-  VArray<float> point_factors_;
+  VArraySpan<float> point_factors_;
   IndexMaskMemory selected_curve_memory_;
   IndexMask curve_selection_;
 
@@ -79,8 +79,8 @@ struct SmoothOperationExecutor {
     brush_strength_ = brush_strength_get(*ctx_.scene, *brush_, stroke_extension);
     brush_pos_re_ = stroke_extension.mouse_position;
 
-    point_factors_ = *curves_->attributes().lookup_or_default<float>(
-        ".selection", bke::AttrDomain::Point, 1.0f);
+    point_factors_ = VArraySpan<float>(*curves_->attributes().lookup_or_default<float>(
+        ".selection", bke::AttrDomain::Point, 1.0f));
     curve_selection_ = curves::retrieve_selected_curves(*curves_id_, selected_curve_memory_);
     transforms_ = CurvesSurfaceTransforms(*object_, curves_id_->surface);
 
@@ -4741,7 +4741,19 @@ static bool partial_redraw_array_merge(ImagePaintPartialRedraw *pr,
   return touch;
 }
 
-/* Loop over all images on this mesh and update any we have touched */
+/* Loop over all images on this mesh and update any we have touched
+ *
+ * NOTE: This is where 8K canvases hurt: dabs composite into the CPU ImBuf and every stroke step
+ * re-uploads the merged dirty rectangles to the GPU texture, so latency scales with brush
+ * radius times texture resolution regardless of how fast the compositing is. Inverting the
+ * residency -- rendering dabs directly into the #GPUTexture and syncing dirtied tiles back to
+ * the ImBuf asynchronously for save/undo -- is the structural fix, and the existing #PaintTile
+ * undo granularity already defines the sync unit. The constraints to respect: undo must capture
+ * the pre-stroke tile contents *before* the first GPU dab touches them (readback at stroke
+ * start for tiles entering the dirty set, not at stroke end); color management runs on the CPU
+ * path today (`imapaint_image_update` handles byte/float mirroring) and must be reproduced or
+ * bypassed consistently in the GPU composite; and external editing / packing expects the ImBuf
+ * to be authoritative at save time, so saves force-complete the pending syncs. */
 static bool project_image_refresh_tagged(ProjPaintState *ps)
 {
   ImagePaintPartialRedraw *pr;
@@ -1857,6 +1857,16 @@ static void wpaint_stroke_update_step(bContext *C,
   mul_v3_m4v3(loc_world, ob->object_to_world, ss->cache->true_location);
   vwpaint::last_stroke_update(scene, loc_world);
 
+  /* NOTE: This tag makes every stroke sample re-run the object's full modifier stack (weights
+   * feed deformation, so geometry must re-evaluate), which is what limits painting on heavy rigs
+   * to a few fps -- the brush work above is cheap by comparison. Two-part fast path: samples
+   * arriving faster than the display rate can accumulate into the stroke cache and flush as one
+   * weight update per redraw instead of per sample; and the flush only needs the deform segment
+   * of the stack re-run, since weight edits cannot change topology -- the evaluation split that
+   * sculpt mode's deform-only updates already use (`ID_RECALC_GEOMETRY` on vertex data with the
+   * modifier evaluation entry reusing the cached pre-deform state), rather than the full
+   * `DEG_id_tag_update(..., 0)` below. Both need care with multi-object symmetry painting, where
+   * each object flushes independently. */
   BKE_mesh_batch_cache_dirty_tag(mesh, BKE_MESH_BATCH_DIRTY_ALL);
 
   DEG_id_tag_update(&mesh->id, 0);
@@ -5305,6 +5305,10 @@ void SCULPT_flush_update_done(const bContext *C, Object *ob, SculptUpdateType up
   SculptSession *ss = ob->sculpt;
   Mesh *mesh = static_cast<Mesh *>(ob->data);
 
+  /* The depsgraph updates tagged below may free or rebuild data the deferred normal update
+   * reads, so it has to finish first. */
+  bke::pbvh::update_normals_join(*ss->pbvh);
+
   /* Always needed for linked duplicates. */
   bool need_tag = (ID_REAL_USERS(&mesh->id) > 1);
 
@@ -5500,6 +5504,10 @@ static void sculpt_stroke_update_step(bContext *C,
   StrokeCache *cache = ss->cache;
   cache->stroke_distance = paint_stroke_distance_get(stroke);
 
+  /* A deferred normal update from the previous step may still be running; it has to finish
+   * before this step modifies positions (also see #update_normals_async). */
+  blender::bke::pbvh::update_normals_join(*ss->pbvh);
+
   SCULPT_stroke_modifiers_check(C, ob, brush);
   sculpt_update_cache_variants(C, sd, ob, itemptr);
   sculpt_restore_mesh(sd, ob);
@@ -5562,6 +5570,10 @@ static void sculpt_stroke_update_step(bContext *C,
   }
   else {
     SCULPT_flush_update_step(C, SCULPT_UPDATE_COORDS);
+    /* Recompute the normals of the nodes modified by this step in the background, overlapping
+     * the work with event handling until the next reader joins (the draw code and the next
+     * stroke step do). */
+    blender::bke::pbvh::update_normals_async(*ss->pbvh, ss->subdiv_ccg);
   }
 }
 
@@ -1496,6 +1496,15 @@ static int filelist_intern_free_main_files(FileList *filelist)
   return removed_counter;
 }
 
+/* NOTE: Preview generation already runs in a background #TaskPool, but every entry pays the full
+ * freedesktop cache probe in #IMB_thumb_manage: hash the URI, stat the source and the cached
+ * thumbnail, and on mismatch re-generate (for .blend files that re-parses the file header in
+ * `blendthumb`). On directories with thousands of assets the per-file stat/hash traffic is what
+ * makes first paint slow even when every thumbnail is already cached. A per-directory index file
+ * (entry name, source mtime/size, thumbnail file name) stored alongside the cache layout from
+ * `IMB_thumbs.h` would let the whole directory validate with one read plus one stat per file,
+ * pushing only the misses into this pool; the index is advisory and anything stale falls back to
+ * the per-file path below. */
 static void filelist_cache_preview_runf(TaskPool *__restrict pool, void *taskdata)
 {
   FileListEntryCache *cache = static_cast<FileListEntryCache *>(BLI_task_pool_user_data(pool));
@@ -390,6 +390,18 @@ static void stats_object_sculpt(const Object *ob, SceneStats *stats)
 }
 
 /* Statistics displayed in info header. Called regularly on scene changes. */
+/* NOTE: Stats are not recounted per redraw — the result is cached on the view layer and only
+ * rebuilt after ED_info_stats_clear(). The problem is the granularity of that invalidation: the
+ * clear fires from notifiers on any scene change, so during playback or any animated scene every
+ * frame pays a full pass over all evaluated objects, and one deforming object invalidates counts
+ * for thousands of static ones. The object-mode path below is a pure sum over per-object
+ * contributions, so it can be incremental: cache each object's count contribution keyed on its
+ * geometry (mesh_eval topology doesn't change under deformation — counts survive even geometry
+ * recalc unless topology-affecting), re-tally only objects whose evaluated geometry instance
+ * changed, and adjust the aggregate by the difference. The edit/pose/sculpt paths read live
+ * session state and are bounded by the edited objects, so they stay as-is. The dupli handling
+ * (objects_gset de-duplicating shared data) is the one part that forces a global view — the
+ * per-object cache has to store both the "first user" and "repeat user" contributions. */
 static void stats_update(Depsgraph *depsgraph,
                          const Scene *scene,
                          ViewLayer *view_layer,
@@ -3530,6 +3530,18 @@ static void reroute_node_prepare_for_draw(bNode &node)
   node.runtime->totr.ymin = loc.y - size;
 }
 
+/* NOTE: Two of the classic big-tree costs are already handled: node drawing early-outs on a
+ * v2d.cur intersection test, and link curves are evaluated in the shader from instanced
+ * endpoint data (see nodelink_batch in drawnode.cc), so there is no per-redraw CPU bezier
+ * tessellation to cache. What still scales with total node count is this update pass: every node
+ * gets a full uiBlock built with all its buttons on every redraw, visible or not, and that
+ * dominates pans on multi-thousand-node trees. Layout cannot simply be skipped for culled nodes —
+ * totr of every node feeds frame sizing below and link endpoints — but it can be split: the
+ * geometry part (socket positions, totr) is cheap and must stay global, while button creation
+ * (node_update_basis() calling into uiDefBut via the declaration's draw callbacks) is the
+ * expensive part and is only needed for nodes that pass the same culling test the draw pass
+ * uses. An empty uiBlock still has to exist per node since event handling looks blocks up by
+ * name. */
 static void node_update_nodetree(const bContext &C,
                                  TreeDrawContext &tree_draw_ctx,
                                  bNodeTree &ntree,
@@ -1134,6 +1134,18 @@ static void outliner_clear_newid_from_main(Main *bmain)
 /** \name Main Tree Building API
  * \{ */
 
+/* NOTE: Except for the RGN_DRAW_NO_REBUILD shortcut, every redraw that reaches here frees the
+ * whole #TreeElement tree and rebuilds it from Main -- with 100k objects that is 100k element
+ * allocations, re-sort and re-filter per notifier, regardless of how small the change was. The
+ * persistent identity needed for an incremental model already exists: #TreeStoreElem entries
+ * (and the `tree_hash` rebuilt above) key elements by (ID, type, index/nr) and survive rebuilds
+ * to carry open/selected state. An incremental build would keep the TreeElement tree itself
+ * alive too, map notifier categories to the subtrees they can affect (rename: re-sort one
+ * sibling range; collection membership: rebuild one collection subtree; full ID add/remove:
+ * current behavior as fallback), and mark the rest untouched. Orthogonally, element creation
+ * could stop at collapsed subtrees -- children materialize on expand -- which bounds the element
+ * count by what is visible rather than by scene size, at the cost of search and "expand all"
+ * having to force-materialize. */
 void outliner_build_tree(Main *mainvar,
                          Scene *scene,
                          ViewLayer *view_layer,
@@ -89,6 +89,16 @@ class SpreadsheetLayoutDrawer : public SpreadsheetDrawer {
     UI_but_drawflag_disable(but, UI_BUT_TEXT_LEFT);
   }
 
+  /* NOTE: Row virtualization already exists — spreadsheet_draw.cc only calls this for visible
+   * rows — so the per-redraw cost for huge attributes is per-cell, not per-row-count: a virtual
+   * GVArray lookup (the row_indices indirection defeats any span fast path), stringstream
+   * formatting, and a uiBut allocation for every visible cell, all redone on every redraw
+   * including pure scrolls. The fix is column-wise: gather each column's visible window once per
+   * redraw with GVArray::materialize() over the selected indices into a reused typed buffer,
+   * format from that flat span, and keep the formatted strings cached until either the scroll
+   * window or the data changes — the viewer-path data version that already re-triggers
+   * spreadsheet updates is the right invalidation key. Label-only cells could skip the uiBut
+   * entirely, but that changes tooltip/selection behavior and should be a separate change. */
   void draw_content_cell(int row_index, int column_index, const CellDrawParams &params) const final
   {
     const int real_index = spreadsheet_layout_.row_indices[row_index];
@@ -2378,6 +2378,16 @@ float view3d_depth_near(ViewDepths *d)
   return far == far_real ? FLT_MAX : far;
 }
 
+/* NOTE: Every caller pays a depth-only scene render per invocation; the
+ * V3D_RUNTIME_DEPTHBUF_OVERRIDDEN check below only de-duplicates within one draw cycle, so each
+ * surface-project click in a heavy scene is an extra render. The viewport's last regular draw
+ * already left a scene depth buffer in the GPUViewport, which is exactly what the common
+ * V3D_DEPTH_NO_GPENCIL mode re-renders. A shared service would read that buffer back (keeping the
+ * ViewDepths copy the queries below consume), keyed on the view matrices and the depsgraph update
+ * count, so repeated queries between scene changes are readback-free — and the readback can be
+ * issued asynchronously right after a regular draw completes, hiding it entirely for
+ * click-then-query interactions. The filtered modes (gpencil-only, object-only) have no
+ * counterpart in the regular draw and must keep this re-render path. */
 void ED_view3d_depth_override(Depsgraph *depsgraph,
                               ARegion *region,
                               View3D *v3d,
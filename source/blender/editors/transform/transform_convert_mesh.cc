@@ -1484,6 +1484,17 @@ static void VertsToTransData(TransInfo *t,
   }
 }
 
+/* NOTE: This walks the BMesh serially, filling one #TransData per vertex, and is the dominant
+ * part of G/R/S initiation latency on million-vertex selections. The per-vertex work in
+ * #VertsToTransData is independent, so the fill parallelizes if the iteration is restructured:
+ * a first pass over `bm->vtable` (requires an up-to-date vert table, which
+ * `BM_mesh_elem_table_ensure` gives us) counts/compacts candidate indices per chunk, then a
+ * parallel-for writes TransData for disjoint `tc->data` ranges computed by prefix sum -- no
+ * per-thread buffers or merge needed since the destination array is preallocated with
+ * `data_len`. The serial remainders are the pieces with cross-vertex state: island/connectivity
+ * calc (already its own pass), mirror matching, and the proportional-editing distance field --
+ * the latter is also the piece worth making lazy, since `T_PROP_EDIT` distances are only needed
+ * once the user actually drags, not at invoke time. */
 static void createTransEditVerts(bContext * /*C*/, TransInfo *t)
 {
   FOREACH_TRANS_DATA_CONTAINER (t, tc) {
@@ -17,6 +17,18 @@
   (SCE_SNAP_TO_EDGE | SCE_SNAP_TO_EDGE_ENDPOINT | SCE_SNAP_TO_EDGE_MIDPOINT | \
    SCE_SNAP_TO_EDGE_PERPENDICULAR)
 
+/**
+ * \note Each tool owns its own context, and its caches (the edit-mesh map below, plus the
+ * BVH trees stored in mesh/editmesh runtime) are validated object-by-object inside every snap
+ * query; iterating all snappable objects per mouse move is what makes snapping hitch in heavy
+ * scenes even when nothing changed. The structural fix is a scene-level persistent structure
+ * owned by the depsgraph side rather than by tools: a top-level BVH over object bounds,
+ * per-object trees built lazily on first hit and invalidated individually from depsgraph tags
+ * (geometry tag drops the object's tree, transform tag only refits the top level), shared by
+ * every context -- transform snapping, ruler and the placement tool would all query the same
+ * structure instead of each re-validating per object. The per-context state below would then
+ * reduce to filter callbacks and query parameters, which genuinely differ per tool.
+ */
 struct SnapObjectContext {
   Scene *scene;
 
@@ -14,6 +14,7 @@
 
 #include "DNA_object_types.h"
 #include "DNA_scene_types.h"
+#include "DNA_userdef_types.h"
 
 #include "BLI_listbase.h"
 #include "BLI_utildefines.h"
@@ -131,6 +132,12 @@ void ED_undo_push(bContext *C, const char *str)
 
   eUndoPushReturn push_retval;
 
+  /* Resolve the memory policy from the preference on every push, so toggling it takes effect
+   * without restarting (already-compacted steps simply stay compacted when turned off). */
+  wm->undo_stack->memory_policy = USER_EXPERIMENTAL_TEST(&U, use_undo_compact_memory) ?
+                                      UNDO_MEMORY_POLICY_COMPRESS_COLD :
+                                      UNDO_MEMORY_POLICY_DEFAULT;
+
   /* Only apply limit if this is the last undo step. */
   if (wm->undo_stack->step_active && (wm->undo_stack->step_active->next == nullptr)) {
     BKE_undosys_stack_limit_steps_and_memory(wm->undo_stack, steps - 1, 0);
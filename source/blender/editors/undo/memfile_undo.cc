@@ -328,6 +328,16 @@ static void memfile_undosys_step_free(UndoStep *us_p)
   BKE_memfile_undo_free(us->data);
 }
 
+static void memfile_undosys_step_make_cold(UndoStep *us_p)
+{
+  MemFileUndoStep *us = (MemFileUndoStep *)us_p;
+  if (us->data != nullptr) {
+    /* Only chunks owned exclusively by this step get compressed; the memfile is expanded again
+     * automatically when it is read or used as reference for the next push. */
+    BLO_memfile_compress(&us->data->memfile);
+  }
+}
+
 void ED_memfile_undosys_type(UndoType *ut)
 {
   ut->name = "Global Undo";
@@ -335,6 +345,7 @@ void ED_memfile_undosys_type(UndoType *ut)
   ut->step_encode = memfile_undosys_step_encode;
   ut->step_decode = memfile_undosys_step_decode;
   ut->step_free = memfile_undosys_step_free;
+  ut->step_make_cold = memfile_undosys_step_make_cold;
 
   ut->flags = 0;
 
@@ -428,6 +428,17 @@ static int computeVisibility(ViewMap *viewMap,
 // QI <= 22.
 
 template<typename G, typename I>
+/* NOTE: This loop is the dominant serial cost of line rendering and is parallel in shape:
+ * each ViewEdge's visibility is computed independently from read-only scene geometry, and the
+ * per-edge writes (setQI / setaShape / occluder lists) touch only that edge. What blocks a
+ * straightforward parallel-for is iterator state, not the algorithm: the grids keep the current
+ * ray and traversal cursor inside the grid/iterator objects (see GridDensityProvider and the
+ * `I occluders(grid, ...)` iterators instantiated per edge below), so each worker needs its own
+ * iterator instances over a shared, immutable grid — which the grid already is once filled.
+ * The RenderMonitor progress/break calls must move to the outer scheduler with an atomic
+ * counter. Stroke shader chains are a different story: shaders are user-defined (including
+ * Python-scripted modules) and may carry state across strokes, so strokes cannot be blanket
+ * parallelized — only the built-in stateless shaders could opt in. */
 static void computeCumulativeVisibility(ViewMap *ioViewMap,
                                         G &grid,
                                         real epsilon,
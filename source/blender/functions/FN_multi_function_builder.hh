@@ -144,6 +144,11 @@ execute_array(TypeSequence<ParamTags...> /*param_tags*/,
     /* Having this explicit loop is necessary for MSVC to be able to vectorize this. */
     const int64_t start = mask.start();
     const int64_t end = mask.one_after_last();
+    /* Clang does not support the optimize attributes used above, so ask it for vectorization
+     * explicitly. This is just a hint, the compiler still proves safety itself. */
+#if defined(__clang__)
+#  pragma clang loop vectorize(enable) interleave(enable)
+#endif
     for (int64_t i = start; i < end; i++) {
       element_fn(args[i]...);
     }
@@ -180,6 +185,9 @@ execute_materialized_impl(TypeSequence<ParamTags...> /*param_tags*/,
                           const int64_t size,
                           Chunks &&__restrict... chunks)
 {
+#if defined(__clang__)
+#  pragma clang loop vectorize(enable) interleave(enable)
+#endif
   for (int64_t i = 0; i < size; i++) {
     element_fn(chunks[i]...);
   }
@@ -20,6 +20,14 @@
  * TBB schedules tasks helps with that: a thread will next process the task that it added to a task
  * pool just before.
  *
+ * Chains of nodes with a single consumer do not go through the task pool at all: when a node
+ * finishes and its computed value makes exactly one other node ready, that node is pushed onto a
+ * stack local to the current task and executed right away on the same thread. A task therefore
+ * processes a whole chain as one continuation, and the value is moved (not copied) into the last
+ * linked input, so no scheduling round-trip or extra buffer happens along the chain. Only when a
+ * task has accumulated many ready nodes is part of its local queue split off to the task pool so
+ * that other threads can steal work.
+ *
  * Communication between threads is synchronized by using a mutex in every node. When a thread
  * wants to access the state of a node, its mutex has to be locked first (with some documented
  * exceptions). The assumption here is that most nodes are only ever touched by a single thread and
@@ -73,6 +73,18 @@ static void fill_new_attribute(const Span<const GeometryComponent *> src_compone
   }
 }
 
+/* NOTE: Joining copies every attribute of every input into freshly allocated flat arrays, even
+ * though the sources are usually implicit-sharing backed and never modified afterwards. The copy
+ * is not an accident of this function — it is forced by the storage model: CustomData layers and
+ * #GSpanAttributeWriter only know contiguous arrays, so sharing at any granularity finer than a
+ * whole layer cannot be expressed. Append-style elision therefore needs segmented (chunked)
+ * attribute storage first: a layer holding a list of implicit-sharing chunk references, where
+ * join appends source chunks by incrementing user counts and only newly created ranges allocate.
+ * That is an attribute-storage project, not a join change — every consumer that calls
+ * #get_internal_span() or takes raw CustomData pointers assumes contiguity and would need the
+ * (chunked → flat) materialization fallback. Until then the honest wins here are smaller: the
+ * per-attribute loop below parallelizes over attributes, and the single-input case can move
+ * components instead of copying. */
 static void join_attributes(const Span<const GeometryComponent *> src_components,
                             GeometryComponent &result,
                             const Span<StringRef> ignored_attributes = {})
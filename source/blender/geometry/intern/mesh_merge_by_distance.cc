@@ -1423,6 +1423,74 @@ static void customdata_weld(
   }
 }
 
+/**
+ * Complement #CustomData_interp_batch with the layers it skips: that function only writes layers
+ * that have a `typeInfo->interp` callback, while #customdata_weld also accumulates math-only
+ * layers, copies the first source element for layers with neither, and re-adds the
+ * #CD_MVERT_SKIN flags dropped by its `interp`. Apply that remaining handling to every group.
+ */
+static void customdata_weld_skipped_layers(const CustomData *source,
+                                           CustomData *dest,
+                                           const OffsetIndices<int> src_groups,
+                                           const Span<int> src_indices,
+                                           const Span<int> dest_indices)
+{
+  /* Walk matching source/dest layer pairs the same way #customdata_weld does (layers are ordered
+   * by type). */
+  int dest_i = 0;
+  for (int src_i = 0; src_i < source->totlayer; src_i++) {
+    const eCustomDataType type = eCustomDataType(source->layers[src_i].type);
+
+    while (dest_i < dest->totlayer && dest->layers[dest_i].type < type) {
+      dest_i++;
+    }
+    if (dest_i == dest->totlayer) {
+      break;
+    }
+    if (dest->layers[dest_i].type != type) {
+      continue;
+    }
+
+    void *src_data = source->layers[src_i].data;
+    if (type == CD_MVERT_SKIN) {
+      /* See the note in #customdata_weld: the `interp` of #CD_MVERT_SKIN does not include the
+       * flags, so re-add #MVERT_SKIN_ROOT and #MVERT_SKIN_LOOSE if any merged vertex has them. */
+      MVertSkin *vs_dst = static_cast<MVertSkin *>(dest->layers[dest_i].data);
+      for (const int i : dest_indices.index_range()) {
+        int vs_flag = 0;
+        for (const int j : src_groups[i]) {
+          vs_flag |= ((MVertSkin *)src_data)[src_indices[j]].flag;
+        }
+        vs_dst[dest_indices[i]].flag = vs_flag;
+      }
+    }
+    else if (CustomData_layer_has_interp(dest, dest_i)) {
+      /* Already written by #CustomData_interp_batch. */
+    }
+    else if (CustomData_layer_has_math(dest, dest_i)) {
+      const int size = CustomData_sizeof(type);
+      void *dst_data = dest->layers[dest_i].data;
+      for (const int i : dest_indices.index_range()) {
+        const IndexRange group = src_groups[i];
+        void *v_dst = POINTER_OFFSET(dst_data, size_t(dest_indices[i]) * size);
+        for (const int j : group) {
+          CustomData_data_add(
+              type, v_dst, POINTER_OFFSET(src_data, size_t(src_indices[j]) * size));
+        }
+        CustomData_data_multiply(type, v_dst, 1.0f / group.size());
+      }
+    }
+    else {
+      for (const int i : dest_indices.index_range()) {
+        CustomData_copy_layer_type_data(
+            source, dest, type, src_indices[src_groups[i].start()], dest_indices[i], 1);
+      }
+    }
+
+    dest_i++;
+  }
+}
+
 /**
  * \brief Applies to `CustomData *dest` the values in `CustomData *source`.
  *
@@ -1464,6 +1532,10 @@ static void merge_customdata_all(const CustomData *source,
   }
   OffsetIndices<int> groups_offs(groups_offs_);
 
+  Vector<int> weld_src_offsets;
+  Vector<int> weld_src_indices;
+  Vector<int> weld_dest_indices;
+
   bool finalize_map = false;
   int dest_index = 0;
   for (int i = 0; i < source_size; i++) {
@@ -1484,11 +1556,17 @@ static void merge_customdata_all(const CustomData *source,
     if (dest_map[i] == i) {
       if (do_mix_data) {
         const IndexRange grp_buffer_range = groups_offs[i];
-        customdata_weld(source,
-                        dest,
-                        &groups_buffer[grp_buffer_range.start()],
-                        grp_buffer_range.size(),
-                        dest_index);
+        if (grp_buffer_range.size() == 1) {
+          CustomData_copy_data(
+              source, dest, groups_buffer[grp_buffer_range.start()], dest_index, 1);
+        }
+        else {
+          /* Defer the actual interpolation, so all groups run in one parallel batch below. */
+          weld_src_offsets.append(weld_src_indices.size());
+          weld_src_indices.extend(
+              Span<int>(&groups_buffer[grp_buffer_range.start()], grp_buffer_range.size()));
+          weld_dest_indices.append(dest_index);
+        }
       }
       else {
         CustomData_copy_data(source, dest, i, dest_index, 1);
@@ -1516,6 +1594,18 @@ static void merge_customdata_all(const CustomData *source,
     }
   }
 
+  if (!weld_dest_indices.is_empty()) {
+    weld_src_offsets.append(weld_src_indices.size());
+    CustomData_interp_batch(source,
+                            dest,
+                            OffsetIndices<int>(weld_src_offsets),
+                            weld_src_indices,
+                            {},
+                            weld_dest_indices);
+    customdata_weld_skipped_layers(
+        source, dest, OffsetIndices<int>(weld_src_offsets), weld_src_indices, weld_dest_indices);
+  }
+
   if (finalize_map) {
     for (const int i : r_final_map.index_range()) {
       if (r_final_map[i] < 0) {
@@ -105,6 +105,16 @@ float volume_compute_voxel_size(const Depsgraph *depsgraph,
   return voxel_size / volume_simplify;
 }
 
+/* NOTE: There is no dense intermediate here — `meshToVolume` rasterizes straight into a sparse
+ * tree and is leaf-parallel internally (TBB), as is `volumeToMesh` on the other side. The waste
+ * on VDB-heavy node groups is at the boundaries: a volume→mesh→volume round-trip re-rasterizes a
+ * surface that started as a level set, and groups that branch convert the same mesh with the same
+ * settings several times per evaluation. Both are caching problems above this function: the
+ * produced grid is a pure function of (mesh topology/positions identity, transform, voxel size,
+ * band widths), so a cache on the mesh runtime keyed on those — invalidated for free by
+ * position-array implicit sharing, like the BVH cache — would collapse repeated conversions, and
+ * Volume to Mesh could attach its source grid to the output mesh under the same key so a
+ * following Mesh to Volume with matching settings passes the level set through untouched. */
 static openvdb::FloatGrid::Ptr mesh_to_fog_volume_grid(
     const Mesh *mesh,
     const float4x4 &mesh_to_volume_space_transform,
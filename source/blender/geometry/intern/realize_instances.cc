@@ -1562,6 +1562,23 @@ static void remove_id_attribute_from_instances(bke::GeometrySet &geometry_set)
   });
 }
 
+/* NOTE: Realization always produces one flat copy: N instances of the same mesh become N full
+ * copies of every attribute, which is where the peak-memory multiplier comes from on environment
+ * files. Two elisions are compatible with this design without changing the output contract:
+ *
+ * - Copy elision for repeated sources. Non-position, non-id attributes of repeated instances of
+ *   the same source are byte-identical per copy; the gather step knows the repetition (tasks
+ *   reference the preprocessed unique geometries), so the copy loops could write each unique
+ *   source's block once and replicate with memcpy instead of re-gathering through the virtual
+ *   array per task. Implicit-sharing cannot help inside one merged array — sharing works at
+ *   whole-array granularity — so true zero-copy would require the result to stay a multi-block
+ *   "geometry sequence", which is an output-contract change, not an optimization here.
+ *
+ * - Lazy realization for reductions. Downstream consumers that only need counts or bounds
+ *   (Attribute Statistic on position, Bounding Box) can compute per-unique-source results and
+ *   combine over transforms. That decision belongs in the nodes, not here: this function cannot
+ *   know its caller's needs, but the preprocessed per-unique-geometry info it builds is the
+ *   piece such nodes would reuse. */
 bke::GeometrySet realize_instances(bke::GeometrySet geometry_set,
                                    const RealizeInstancesOptions &options)
 {
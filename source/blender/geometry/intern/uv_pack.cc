@@ -1587,6 +1587,17 @@ static bool rotate_inside_square(const Span<std::unique_ptr<UVAABBIsland>> islan
  * => if `n` can ever be large, `bitmap_radix` will need to vary accordingly.
  */
 
+/* NOTE: Island placement is strictly greedy-serial -- each island's position depends on the
+ * occupancy written by all previous ones -- so the wall time for thousands of islands is the
+ * per-island candidate search in #find_best_fit_for_island, not an inherently serial algorithm.
+ * Within one island the search parallelizes cleanly: occupancy is only read during the search
+ * (the `write` trace happens after a spot is accepted), so N candidate (position, rotation)
+ * probes can be evaluated concurrently with the winner chosen by scan-line order to keep results
+ * deterministic. The inner cost, #Occupancy::trace_triangle, rasterizes with scalar math and a
+ * per-pixel spiral probe; processing bitmap spans with SIMD (test several pixels of a row per
+ * iteration) compounds with the candidate parallelism. A coarser mip of the bitmap can reject
+ * most candidates before the fine trace, similar to how `trace_island` already early-outs per
+ * triangle. */
 static int64_t pack_island_xatlas(const Span<std::unique_ptr<UVAABBIsland>> island_indices,
                                   const Span<PackIsland *> islands,
                                   const float scale,
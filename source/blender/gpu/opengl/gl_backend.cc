@@ -522,6 +522,7 @@ GLint GLContext::max_ssbo_binds = 0;
 
 bool GLContext::base_instance_support = false;
 bool GLContext::clear_texture_support = false;
+bool GLContext::buffer_storage_support = false;
 bool GLContext::copy_image_support = false;
 bool GLContext::debug_layer_support = false;
 bool GLContext::direct_state_access_support = false;
@@ -613,6 +614,8 @@ void GLBackend::capabilities_init()
   glGetIntegerv(GL_MAX_COMPUTE_SHADER_STORAGE_BLOCKS, &max_ssbo_binds);
   GLContext::max_ssbo_binds = min_ii(GLContext::max_ssbo_binds, max_ssbo_binds);
   GLContext::base_instance_support = epoxy_has_gl_extension("GL_ARB_base_instance");
+  GLContext::buffer_storage_support = epoxy_gl_version() >= 44 ||
+                                      epoxy_has_gl_extension("GL_ARB_buffer_storage");
   GLContext::clear_texture_support = epoxy_has_gl_extension("GL_ARB_clear_texture");
   GLContext::copy_image_support = epoxy_has_gl_extension("GL_ARB_copy_image");
   GLContext::debug_layer_support = epoxy_gl_version() >= 43 ||
@@ -55,6 +55,27 @@ void GLVaoCache::init()
   vao_base_instance_ = 0;
   base_instance_ = 0;
   vao_id_ = 0;
+  vbo_handle_generation_ = 0;
+}
+
+/** Sum of the handle generations of every VBO attached to the batch. Changes whenever a
+ * streaming VBO rotates to another slot of its ring (see #GLVertBuf::stream_ring_upload). */
+static uint32_t batch_handle_generation(const GLBatch *batch)
+{
+  uint32_t generation = 0;
+  for (int v = 0; v < GPU_BATCH_VBO_MAX_LEN; v++) {
+    const GLVertBuf *vbo = batch->verts_(v);
+    if (vbo) {
+      generation += vbo->handle_generation();
+    }
+  }
+  for (int v = 0; v < GPU_BATCH_INST_VBO_MAX_LEN; v++) {
+    const GLVertBuf *vbo = batch->inst_(v);
+    if (vbo) {
+      generation += vbo->handle_generation();
+    }
+  }
+  return generation;
 }
 
 void GLVaoCache::insert(const GLShaderInterface *interface, GLuint vao)
@@ -214,7 +235,9 @@ GLuint GLVaoCache::base_instance_vao_get(GPUBatch *batch, int i_first)
   /* Make sure the interface is up to date. */
   Shader *shader = GLContext::get()->shader;
   GLShaderInterface *interface = static_cast<GLShaderInterface *>(shader->interface);
-  if (interface_ != interface) {
+  if (interface_ != interface ||
+      vbo_handle_generation_ != batch_handle_generation(static_cast<const GLBatch *>(batch)))
+  {
     vao_get(batch);
     /* Trigger update. */
     base_instance_ = 0;
@@ -235,6 +258,15 @@ GLuint GLVaoCache::vao_get(GPUBatch *batch)
 {
   this->context_check();
 
+  const uint32_t handle_generation = batch_handle_generation(static_cast<const GLBatch *>(batch));
+  if (vbo_handle_generation_ != handle_generation) {
+    /* A streaming VBO rotated its buffer handle. Bindings are only recorded into a VAO on cache
+     * miss, so every cached VAO still points to the previous handle. Rebuild them all. */
+    this->clear();
+    this->context_check();
+    vbo_handle_generation_ = handle_generation;
+  }
+
   Shader *shader = GLContext::get()->shader;
   GLShaderInterface *interface = static_cast<GLShaderInterface *>(shader->interface);
   if (interface_ != interface) {
@@ -42,6 +42,9 @@ class GLVaoCache {
   /** Used when arb_base_instance is not supported. */
   GLuint vao_base_instance_ = 0;
   int base_instance_ = 0;
+  /** Sum of the VBO handle generations when the VAOs were last built. Streaming VBOs rotate
+   * their handle on upload, which invalidates every VAO recorded with the previous one. */
+  uint32_t vbo_handle_generation_ = 0;
 
   bool is_dynamic_vao_count = false;
   union {
@@ -8,8 +8,12 @@
 
 #include <iomanip>
 
+#include "BKE_appdir.h"
 #include "BKE_global.h"
 
+#include "BLI_fileops.h"
+#include "BLI_hash_md5.h"
+#include "BLI_path_util.h"
 #include "BLI_string.h"
 #include "BLI_vector.hh"
 
@@ -1164,7 +1168,7 @@ const char *GLShader::glsl_patch_get(GLenum gl_stage)
   return glsl_patch_default_get();
 }
 
-GLuint GLShader::create_shader_stage(GLenum gl_stage, MutableSpan<const char *> sources)
+GLuint GLShader::create_shader_stage(GLenum gl_stage, const std::string &sources)
 {
   GLuint shader = glCreateShader(gl_stage);
   if (shader == 0) {
@@ -1172,10 +1176,8 @@ GLuint GLShader::create_shader_stage(GLenum gl_stage, MutableSpan<const char *>
     return 0;
   }
 
-  /* Patch the shader code using the first source slot. */
-  sources[0] = glsl_patch_get(gl_stage);
-
-  glShaderSource(shader, sources.size(), sources.data(), nullptr);
+  const char *sources_c_str = sources.c_str();
+  glShaderSource(shader, 1, &sources_c_str, nullptr);
   glCompileShader(shader);
 
   GLint status;
@@ -1185,18 +1187,19 @@ GLuint GLShader::create_shader_stage(GLenum gl_stage, MutableSpan<const char *>
     glGetShaderInfoLog(shader, sizeof(log), nullptr, log);
     if (log[0] != '\0') {
       GLLogParser parser;
+      Span<const char *> log_sources(&sources_c_str, 1);
       switch (gl_stage) {
         case GL_VERTEX_SHADER:
-          this->print_log(sources, log, "VertShader", !status, &parser);
+          this->print_log(log_sources, log, "VertShader", !status, &parser);
           break;
         case GL_GEOMETRY_SHADER:
-          this->print_log(sources, log, "GeomShader", !status, &parser);
+          this->print_log(log_sources, log, "GeomShader", !status, &parser);
           break;
         case GL_FRAGMENT_SHADER:
-          this->print_log(sources, log, "FragShader", !status, &parser);
+          this->print_log(log_sources, log, "FragShader", !status, &parser);
           break;
         case GL_COMPUTE_SHADER:
-          this->print_log(sources, log, "ComputeShader", !status, &parser);
+          this->print_log(log_sources, log, "ComputeShader", !status, &parser);
           break;
       }
     }
@@ -1213,32 +1216,39 @@ GLuint GLShader::create_shader_stage(GLenum gl_stage, MutableSpan<const char *>
   return shader;
 }
 
+void GLShader::stage_sources_concat(GLenum gl_stage,
+                                    MutableSpan<const char *> sources,
+                                    std::string &r_sources)
+{
+  /* Patch the shader code using the first source slot. */
+  sources[0] = glsl_patch_get(gl_stage);
+  for (const char *source : sources) {
+    r_sources += source;
+  }
+}
+
 void GLShader::vertex_shader_from_glsl(MutableSpan<const char *> sources)
 {
-  vert_shader_ = this->create_shader_stage(GL_VERTEX_SHADER, sources);
+  this->stage_sources_concat(GL_VERTEX_SHADER, sources, vertex_sources_);
 }
 
 void GLShader::geometry_shader_from_glsl(MutableSpan<const char *> sources)
 {
-  geom_shader_ = this->create_shader_stage(GL_GEOMETRY_SHADER, sources);
+  this->stage_sources_concat(GL_GEOMETRY_SHADER, sources, geometry_sources_);
 }
 
 void GLShader::fragment_shader_from_glsl(MutableSpan<const char *> sources)
 {
-  frag_shader_ = this->create_shader_stage(GL_FRAGMENT_SHADER, sources);
+  this->stage_sources_concat(GL_FRAGMENT_SHADER, sources, fragment_sources_);
 }
 
 void GLShader::compute_shader_from_glsl(MutableSpan<const char *> sources)
 {
-  compute_shader_ = this->create_shader_stage(GL_COMPUTE_SHADER, sources);
+  this->stage_sources_concat(GL_COMPUTE_SHADER, sources, compute_sources_);
 }
 
 bool GLShader::finalize(const shader::ShaderCreateInfo *info)
 {
-  if (compilation_failed_) {
-    return false;
-  }
-
   if (info && do_geometry_shader_injection(info)) {
     std::string source = workaround_geometry_shader_source_create(*info);
     Vector<const char *> sources;
@@ -1247,17 +1257,51 @@ bool GLShader::finalize(const shader::ShaderCreateInfo *info)
     geometry_shader_from_glsl(sources);
   }
 
-  glLinkProgram(shader_program_);
+  char binary_filepath[FILE_MAX];
+  const bool use_binary_cache = this->program_binary_cache_path_get(binary_filepath);
 
-  GLint status;
-  glGetProgramiv(shader_program_, GL_LINK_STATUS, &status);
-  if (!status) {
-    char log[5000];
-    glGetProgramInfoLog(shader_program_, sizeof(log), nullptr, log);
-    Span<const char *> sources;
-    GLLogParser parser;
-    this->print_log(sources, log, "Linking", true, &parser);
-    return false;
+  if (use_binary_cache && this->program_binary_load(binary_filepath)) {
+    /* The whole program state was restored from the cache. Stage compilation and linking are
+     * skipped entirely. */
+  }
+  else {
+    if (use_binary_cache) {
+      /* Needs to be set before linking. */
+      glProgramParameteri(shader_program_, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+
+    if (!vertex_sources_.empty()) {
+      vert_shader_ = this->create_shader_stage(GL_VERTEX_SHADER, vertex_sources_);
+    }
+    if (!geometry_sources_.empty()) {
+      geom_shader_ = this->create_shader_stage(GL_GEOMETRY_SHADER, geometry_sources_);
+    }
+    if (!fragment_sources_.empty()) {
+      frag_shader_ = this->create_shader_stage(GL_FRAGMENT_SHADER, fragment_sources_);
+    }
+    if (!compute_sources_.empty()) {
+      compute_shader_ = this->create_shader_stage(GL_COMPUTE_SHADER, compute_sources_);
+    }
+    if (compilation_failed_) {
+      return false;
+    }
+
+    glLinkProgram(shader_program_);
+
+    GLint status;
+    glGetProgramiv(shader_program_, GL_LINK_STATUS, &status);
+    if (!status) {
+      char log[5000];
+      glGetProgramInfoLog(shader_program_, sizeof(log), nullptr, log);
+      Span<const char *> sources;
+      GLLogParser parser;
+      this->print_log(sources, log, "Linking", true, &parser);
+      return false;
+    }
+
+    if (use_binary_cache) {
+      this->program_binary_store(binary_filepath);
+    }
   }
 
   if (info != nullptr && info->legacy_resource_location_ == false) {
@@ -1272,6 +1316,132 @@ bool GLShader::finalize(const shader::ShaderCreateInfo *info)
 
 /** \} */
 
+/* -------------------------------------------------------------------- */
+/** \name Program Binary Cache
+ *
+ * Linked programs are stored as driver binaries inside the user cache folder so that later
+ * sessions can skip the driver compilation entirely. The key covers the driver identity and the
+ * full patched sources. Drivers are free to reject a stored binary at any time (e.g. after an
+ * update), in which case the program is recompiled normally and the file rewritten.
+ * \{ */
+
+static const char *program_binary_cache_dir_get()
+{
+  static std::string dirpath_str = []() -> std::string {
+    char cache_dirpath[FILE_MAX];
+    if (!BKE_appdir_folder_caches(cache_dirpath, sizeof(cache_dirpath))) {
+      return "";
+    }
+    char dirpath[FILE_MAX];
+    BLI_path_join(dirpath, sizeof(dirpath), cache_dirpath, "gl-shader-cache");
+    if (!BLI_dir_create_recursive(dirpath)) {
+      return "";
+    }
+    return dirpath;
+  }();
+  return dirpath_str.empty() ? nullptr : dirpath_str.c_str();
+}
+
+bool GLShader::program_binary_cache_path_get(char r_filepath[/*FILE_MAX*/ 1024])
+{
+  if (G.debug & G_DEBUG_GPU) {
+    /* Debugging needs the compilation warnings that a cache hit would skip. */
+    return false;
+  }
+  static GLint binary_format_len = []() {
+    GLint len = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &len);
+    return len;
+  }();
+  if (binary_format_len <= 0) {
+    return false;
+  }
+  const char *cache_dirpath = program_binary_cache_dir_get();
+  if (cache_dirpath == nullptr) {
+    return false;
+  }
+
+  /* The binary format is driver specific and the GLSL patch already depends on context
+   * capabilities, so the driver identity has to be part of the key. */
+  std::string key_data;
+  for (const GLenum name : {GL_VENDOR, GL_RENDERER, GL_VERSION}) {
+    if (const char *str = reinterpret_cast<const char *>(glGetString(name))) {
+      key_data += str;
+    }
+    key_data += ';';
+  }
+  key_data += transform_feedback_names_key_;
+  key_data += vertex_sources_;
+  key_data += geometry_sources_;
+  key_data += fragment_sources_;
+  key_data += compute_sources_;
+
+  uint32_t digest[4];
+  char hex_digest[33];
+  BLI_hash_md5_buffer(key_data.c_str(), key_data.size(), digest);
+  BLI_hash_md5_to_hexdigest(digest, hex_digest);
+
+  char filename[64];
+  SNPRINTF(filename, "%s.bin", hex_digest);
+  BLI_path_join(r_filepath, FILE_MAX, cache_dirpath, filename);
+  return true;
+}
+
+bool GLShader::program_binary_load(const char *binary_filepath)
+{
+  size_t data_len = 0;
+  uint32_t *data = static_cast<uint32_t *>(
+      BLI_file_read_binary_as_mem(binary_filepath, 0, &data_len));
+  if (data == nullptr) {
+    return false;
+  }
+  GLint status = 0;
+  if (data_len > sizeof(uint32_t)) {
+    const GLenum binary_format = GLenum(data[0]);
+    glProgramBinary(
+        shader_program_, binary_format, data + 1, GLsizei(data_len - sizeof(uint32_t)));
+    glGetProgramiv(shader_program_, GL_LINK_STATUS, &status);
+  }
+  MEM_freeN(data);
+  return status != 0;
+}
+
+void GLShader::program_binary_store(const char *binary_filepath)
+{
+  GLint binary_len = 0;
+  glGetProgramiv(shader_program_, GL_PROGRAM_BINARY_LENGTH, &binary_len);
+  if (binary_len <= 0) {
+    return;
+  }
+  uint32_t *data = static_cast<uint32_t *>(MEM_mallocN(sizeof(uint32_t) + binary_len, __func__));
+  GLsizei data_len = 0;
+  GLenum binary_format = 0;
+  glGetProgramBinary(shader_program_, binary_len, &data_len, &binary_format, data + 1);
+  if (data_len > 0) {
+    data[0] = uint32_t(binary_format);
+    /* Write to a temporary file first so that a concurrent Blender session can never read a half
+     * written binary. The rename is atomic, and a binary that fails to load only causes a
+     * recompilation anyway. */
+    char filepath_tmp[FILE_MAX];
+    SNPRINTF(filepath_tmp, "%s.%u.tmp", binary_filepath, shader_program_);
+    FILE *file = BLI_fopen(filepath_tmp, "wb");
+    if (file != nullptr) {
+      const size_t write_len = sizeof(uint32_t) + data_len;
+      const bool success = fwrite(data, 1, write_len, file) == write_len;
+      fclose(file);
+      if (success) {
+        BLI_rename_overwrite(filepath_tmp, binary_filepath);
+      }
+      else {
+        BLI_delete(filepath_tmp, false, false);
+      }
+    }
+  }
+  MEM_freeN(data);
+}
+
+/** \} */
+
 /* -------------------------------------------------------------------- */
 /** \name Binding
  * \{ */
@@ -1303,6 +1473,11 @@ void GLShader::transform_feedback_names_set(Span<const char *> name_list,
   glTransformFeedbackVaryings(
       shader_program_, name_list.size(), name_list.data(), GL_INTERLEAVED_ATTRIBS);
   transform_feedback_type_ = geom_type;
+  /* The varyings are part of the linked program state, so of the binary cache key too. */
+  for (const char *name : name_list) {
+    transform_feedback_names_key_ += name;
+    transform_feedback_names_key_ += ';';
+  }
 }
 
 bool GLShader::transform_feedback_enable(GPUVertBuf *buf_)
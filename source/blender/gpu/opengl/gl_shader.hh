@@ -12,6 +12,8 @@
 
 #include <epoxy/gl.h>
 
+#include <string>
+
 #include "gpu_shader_create_info.hh"
 #include "gpu_shader_private.hh"
 
@@ -36,6 +38,17 @@ class GLShader : public Shader {
   /** True if any shader failed to compile. */
   bool compilation_failed_ = false;
 
+  /**
+   * Source code of each stage, patched and concatenated. Stage compilation is deferred to
+   * #finalize so that the whole program can first be looked up in the on-disk binary cache.
+   */
+  std::string vertex_sources_;
+  std::string geometry_sources_;
+  std::string fragment_sources_;
+  std::string compute_sources_;
+  /** Transform feedback names are part of the program state, so also of the cache key. */
+  std::string transform_feedback_names_key_;
+
   eGPUShaderTFBType transform_feedback_type_ = GPU_SHADER_TFB_NONE;
 
  public:
@@ -84,14 +97,29 @@ class GLShader : public Shader {
 
   bool is_compute() const
   {
-    return compute_shader_ != 0;
+    return !compute_sources_.empty();
   }
 
  private:
   const char *glsl_patch_get(GLenum gl_stage);
 
+  /** Patch the source slots and append them to the stored stage sources. */
+  void stage_sources_concat(GLenum gl_stage,
+                            MutableSpan<const char *> sources,
+                            std::string &r_sources);
+
   /** Create, compile and attach the shader stage to the shader program. */
-  GLuint create_shader_stage(GLenum gl_stage, MutableSpan<const char *> sources);
+  GLuint create_shader_stage(GLenum gl_stage, const std::string &sources);
+
+  /**
+   * Get the path of this program inside the on-disk binary cache.
+   * Return false if the cache cannot be used (no cache folder, no binary format, GPU debugging).
+   */
+  bool program_binary_cache_path_get(char r_filepath[/*FILE_MAX*/ 1024]);
+  /** Try to restore the full program state from a cached binary. */
+  bool program_binary_load(const char *binary_filepath);
+  /** Save the linked program binary for reuse by later sessions. */
+  void program_binary_store(const char *binary_filepath);
 
   /**
    * \brief features available on newer implementation such as native barycentric coordinates
@@ -40,6 +40,12 @@ void GLVertBuf::release_data()
     return;
   }
 
+  if (stream_ring_size_ != 0) {
+    /* Also frees the slot currently aliased by `vbo_id_`. */
+    this->stream_ring_free();
+    vbo_id_ = 0;
+  }
+
   if (vbo_id_ != 0) {
     GPU_TEXTURE_FREE_SAFE(buffer_texture_);
     GLContext::buf_free(vbo_id_);
@@ -81,10 +87,97 @@ void GLVertBuf::upload_data()
   this->bind();
 }
 
+bool GLVertBuf::stream_ring_usable() const
+{
+  /* Only the plain streaming geometry path can rotate buffer handles. Wrapped handles, buffer
+   * textures and device only buffers rely on the handle staying immutable after the first
+   * upload. */
+  return GLContext::buffer_storage_support && usage_ == GPU_USAGE_STREAM && !is_wrapper_ &&
+         !stream_ring_forbidden_ && data != nullptr;
+}
+
+void GLVertBuf::stream_ring_upload()
+{
+  const size_t size_used = this->size_used_get();
+
+  if (stream_ring_size_ < size_used) {
+    const bool first_upload = (stream_ring_[0].vbo_id == 0);
+    this->stream_ring_free();
+    if (first_upload && vbo_id_ != 0) {
+      /* A regular handle may already exist if the buffer was bound or duplicated before. */
+      GLContext::buf_free(vbo_id_);
+      memory_usage -= vbo_size_;
+    }
+    vbo_id_ = 0;
+
+    stream_ring_size_ = this->size_alloc_get();
+    const GLbitfield map_flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    for (StreamRingSlot &slot : stream_ring_) {
+      glGenBuffers(1, &slot.vbo_id);
+      glBindBuffer(GL_ARRAY_BUFFER, slot.vbo_id);
+      glBufferStorage(
+          GL_ARRAY_BUFFER, stream_ring_size_, nullptr, GL_DYNAMIC_STORAGE_BIT | map_flags);
+      slot.mapped = glMapBufferRange(GL_ARRAY_BUFFER, 0, stream_ring_size_, map_flags);
+      memory_usage += stream_ring_size_;
+    }
+  }
+
+  /* Retire the current slot. Every draw using it has been issued before this point. */
+  StreamRingSlot &prev_slot = stream_ring_[stream_ring_index_];
+  if (prev_slot.fence) {
+    glDeleteSync(prev_slot.fence);
+  }
+  prev_slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+  stream_ring_index_ = (stream_ring_index_ + 1) % STREAM_RING_LEN;
+  StreamRingSlot &slot = stream_ring_[stream_ring_index_];
+  if (slot.fence) {
+    /* The slot was retired several uploads ago, so this wait is almost always free. Time out
+     * instead of dead-locking on a driver bug, a late wait only risks a visual glitch. */
+    glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000 /* 1s. */);
+    glDeleteSync(slot.fence);
+    slot.fence = nullptr;
+  }
+  /* Zero copy on the driver side: the write lands directly in mapped driver memory. */
+  memcpy(slot.mapped, data, size_used);
+  vbo_id_ = slot.vbo_id;
+  vbo_size_ = size_used;
+  /* Invalidate every VAO recorded with the previous slot (see #GLVaoCache::vao_get). */
+  handle_generation_++;
+}
+
+void GLVertBuf::stream_ring_free()
+{
+  for (StreamRingSlot &slot : stream_ring_) {
+    if (slot.vbo_id != 0) {
+      /* Deleting the buffer implicitly unmaps it. */
+      GLContext::buf_free(slot.vbo_id);
+      slot.vbo_id = 0;
+      slot.mapped = nullptr;
+      memory_usage -= stream_ring_size_;
+    }
+    if (slot.fence) {
+      if (GLContext::get() != nullptr) {
+        glDeleteSync(slot.fence);
+      }
+      slot.fence = nullptr;
+    }
+  }
+  stream_ring_size_ = 0;
+}
+
 void GLVertBuf::bind()
 {
   BLI_assert(GLContext::get() != nullptr);
 
+  if ((flag & GPU_VERTBUF_DATA_DIRTY) && this->stream_ring_usable()) {
+    this->stream_ring_upload();
+    flag &= ~GPU_VERTBUF_DATA_DIRTY;
+    flag |= GPU_VERTBUF_DATA_UPLOADED;
+    glBindBuffer(GL_ARRAY_BUFFER, vbo_id_);
+    return;
+  }
+
   if (vbo_id_ == 0) {
     glGenBuffers(1, &vbo_id_);
   }
@@ -118,6 +211,16 @@ void GLVertBuf::bind_as_ssbo(uint binding)
 
 void GLVertBuf::bind_as_texture(uint binding)
 {
+  /* Buffer textures need a stable handle, which the ring rotation cannot provide. */
+  stream_ring_forbidden_ = true;
+  if (stream_ring_size_ != 0) {
+    /* Drop the ring and re-upload through the regular path, which stays active from now on. */
+    this->stream_ring_free();
+    vbo_id_ = 0;
+    flag |= GPU_VERTBUF_DATA_DIRTY;
+    /* The regular path below creates yet another handle. */
+    handle_generation_++;
+  }
   bind();
   BLI_assert(vbo_id_ != 0);
   if (buffer_texture_ == nullptr) {
@@ -126,11 +229,17 @@ void GLVertBuf::bind_as_texture(uint binding)
   GPU_texture_bind(buffer_texture_, binding);
 }
 
-void GLVertBuf::read(void *data) const
+void GLVertBuf::read(void *r_data) const
 {
   BLI_assert(is_active());
+  if (stream_ring_size_ != 0) {
+    /* Ring slots are persistently mapped for writing and cannot be mapped again for reading.
+     * The host side copy of a streaming buffer matches the last upload. */
+    memcpy(r_data, data, size_used_get());
+    return;
+  }
   void *result = glMapBuffer(GL_ARRAY_BUFFER, GL_READ_ONLY);
-  memcpy(data, result, size_used_get());
+  memcpy(r_data, result, size_used_get());
   glUnmapBuffer(GL_ARRAY_BUFFER);
 }
 
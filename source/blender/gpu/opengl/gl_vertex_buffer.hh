@@ -23,7 +23,19 @@ class GLVertBuf : public VertBuf {
   friend class GLStorageBuf; /* For sub copy. */
 
  private:
-  /** OpenGL buffer handle. Init on first upload. Immutable after that. */
+  /** Number of slots in the persistent mapped ring used for #GPU_USAGE_STREAM uploads. */
+  static constexpr int STREAM_RING_LEN = 3;
+
+  struct StreamRingSlot {
+    GLuint vbo_id = 0;
+    /** Persistent coherent write mapping of the slot. */
+    void *mapped = nullptr;
+    /** Issued when the slot is retired. Signaled once every draw using it has completed. */
+    GLsync fence = nullptr;
+  };
+
+  /** OpenGL buffer handle. Init on first upload. Immutable after that, except for streaming
+   * buffers where it aliases the current slot of the persistent mapped ring. */
   GLuint vbo_id_ = 0;
   /** Texture used if the buffer is bound as buffer texture. Init on first use. */
   ::GPUTexture *buffer_texture_ = nullptr;
@@ -32,10 +44,28 @@ class GLVertBuf : public VertBuf {
   bool is_wrapper_ = false;
   /** Size on the GPU. */
   size_t vbo_size_ = 0;
+  /** Ring of persistent mapped buffers cycled through on each upload of a streaming buffer.
+   * Avoids the buffer orphaning and re-allocation done by the regular upload path. */
+  StreamRingSlot stream_ring_[STREAM_RING_LEN];
+  /** Storage size of each ring slot, 0 if the ring is not allocated. */
+  size_t stream_ring_size_ = 0;
+  /** Slot currently aliased by `vbo_id_`. */
+  int stream_ring_index_ = 0;
+  /** Set when the handle has to stay stable (e.g. buffer texture), disables the ring. */
+  bool stream_ring_forbidden_ = false;
+  /** Bumped every time `vbo_id_` changes after creation (ring rotation or ring teardown).
+   * #GLVaoCache compares it to detect VAOs still bound to a previous handle. */
+  uint32_t handle_generation_ = 0;
 
  public:
   void bind();
 
+  /** Generation of the current `vbo_id_`, only ever changes for #GPU_USAGE_STREAM buffers. */
+  uint32_t handle_generation() const
+  {
+    return handle_generation_;
+  }
+
   void update_sub(uint start, uint len, const void *data) override;
 
   void read(void *data) const override;
@@ -54,6 +84,13 @@ class GLVertBuf : public VertBuf {
  private:
   bool is_active() const;
 
+  /** True if uploads can go through the persistent mapped ring instead of orphaning. */
+  bool stream_ring_usable() const;
+  /** Rotate the ring, wait for the fence of the new slot and copy `data` into its mapping. */
+  void stream_ring_upload();
+  /** Free every ring slot. Fences can only be freed when a context is active. */
+  void stream_ring_free();
+
   MEM_CXX_CLASS_ALLOC_FUNCS("GLVertBuf");
 };
 
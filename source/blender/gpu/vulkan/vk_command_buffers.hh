@@ -23,6 +23,18 @@ struct VKBufferWithOffset;
 class VKPipeline;
 class VKDescriptorSet;
 
+/**
+ * Owns the command buffers commands are recorded into and their submission.
+ *
+ * Commands are currently recorded immediately, from the thread owning the context, into a single
+ * pool. Parallel encoding (one secondary command buffer per worker thread inside a render pass,
+ * distributed over independent slices of a pass) requires recording to be decoupled from the GPU
+ * module call sites first: calls need to be gathered into a backend owned graph whose nodes can
+ * be recorded later from per-thread `VkCommandPool`s, since a pool and the resource state
+ * tracking (layout transitions, barriers) are not thread safe. That restructuring should happen
+ * here and in #VKContext, not in the draw manager: pass submission order is engine defined and
+ * the draw manager has no knowledge of the barriers the backend inserts between draws.
+ */
 class VKCommandBuffers : public NonCopyable, NonMovable {
   VkCommandPool vk_command_pool_ = VK_NULL_HANDLE;
   enum class Type {
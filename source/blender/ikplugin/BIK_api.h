@@ -23,6 +23,15 @@ void BIK_init_tree(struct Depsgraph *depsgraph,
                    struct Scene *scene,
                    struct Object *ob,
                    float ctime);
+/**
+ * Solve the IK tree(s) rooted at the given pose channel.
+ *
+ * The dependency graph creates one `POSE_IK_SOLVER` operation per tree root, so this function
+ * runs concurrently for independent chains of the same pose (each from its own worker thread).
+ * Implementations must therefore only read/write the channels of their own tree, plus data of
+ * targets which the depsgraph guarantees to be evaluated; shared pose-level data (tree lists of
+ * other roots, channel flags outside the tree) is off limits.
+ */
 void BIK_execute_tree(struct Depsgraph *depsgraph,
                       struct Scene *scene,
                       struct Object *ob,
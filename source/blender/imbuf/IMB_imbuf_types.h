@@ -207,6 +207,18 @@ typedef struct ImBufGPU {
 /** \name Image Buffer
  * \{ */
 
+/**
+ * \note The pixel buffers below are always fully resident: opening an image decodes the whole
+ * frame, so a 16K float texture allocates gigabytes even when only a small region is painted or
+ * displayed. Callers that already work region-wise (image editor partial draw in
+ * `image_draw.cc`, 2D paint partial redraw, compositor previews) could be served by a tiled
+ * variant: a lazily populated tile grid where a tile decodes on first access, backed by the
+ * formats that support partial reads (EXR tiled/scanline, TIFF tiles). That has to be a separate
+ * buffer representation with an explicit region-access API rather than a change to `byte_buffer`
+ * / `float_buffer`, because vast amounts of code index `data` directly and assume a contiguous
+ * full-frame layout; converting a caller means routing it through the region API with a
+ * flatten-on-demand fallback for the rest.
+ */
 typedef struct ImBuf {
   /* dimensions */
   /** Width and Height of our image buffer.
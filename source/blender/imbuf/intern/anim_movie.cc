@@ -805,6 +805,16 @@ static AVFrame *ffmpeg_double_buffer_frame_fallback_get(anim *anim)
  * Postprocess the image in anim->pFrame and do color conversion and de-interlacing stuff.
  *
  * \param ibuf: The frame just read by `ffmpeg_fetchibuf`, processed in-place.
+ *
+ * \note This is the CPU round trip that dominates 4K playback: software decode, `sws_scale` to
+ * RGBA, then a re-upload to a #GPUTexture for display. A zero-copy path would open the decoder
+ * with an FFmpeg hardware device context (VAAPI/NVDEC/VideoToolbox per platform), keep the
+ * decoded `AVFrame` on a GPU surface and import it into a #GPUTexture via the corresponding
+ * interop extension, leaving YUV->RGB to a shader. That cannot live in IMB: ImBuf is CPU memory
+ * by contract and the imbuf module cannot depend on the GPU module, so the interop sits with the
+ * preview-side callers (sequencer/clip editor) behind a capability query, with
+ * `av_hwframe_transfer_data` as the fallback into this exact path for render pipelines and
+ * unsupported codecs. The seeking logic above is unaffected either way.
  */
 static void ffmpeg_postprocess(anim *anim, AVFrame *input, ImBuf *ibuf)
 {
@@ -80,7 +80,9 @@
 #include "BLI_math_color.h"
 #include "BLI_mmap.h"
 #include "BLI_string_utils.hh"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
+#include "BLI_vector.hh"
 
 #include "BKE_idprop.h"
 #include "BKE_image.h"
@@ -1148,6 +1150,11 @@ void IMB_exr_clear_channels(void *handle)
   BLI_freelistN(&data->channels);
 }
 
+/* NOTE: This writes synchronously on the caller's thread; compression itself is threaded through
+ * the OpenEXR global pool (see #imb_initopenexr), but for render output the pipeline still stalls
+ * between frames for the duration of the save. Overlapping the save with the next frame means
+ * handing the `ExrChannel` buffers off to a writer thread above this level (render_result.cc owns
+ * the buffer lifetime), not making this function asynchronous. */
 void IMB_exr_write_channels(void *handle)
 {
   ExrHandle *data = (ExrHandle *)handle;
@@ -1164,14 +1171,13 @@ void IMB_exr_write_channels(void *handle)
       current_rect_half = rect_half;
     }
 
+    blender::Vector<std::pair<ExrChannel *, half *>> half_conversions;
+
     LISTBASE_FOREACH (ExrChannel *, echan, &data->channels) {
       /* Writing starts from last scan-line, stride negative. */
       if (echan->use_half_float) {
-        float *rect = echan->rect;
-        half *cur = current_rect_half;
-        for (size_t i = 0; i < num_pixels; i++, cur++) {
-          *cur = float_to_half_safe(rect[i * echan->xstride]);
-        }
+        /* Conversion to half is deferred, so that all channels convert in parallel below. */
+        half_conversions.append({echan, current_rect_half});
         half *rect_to_write = current_rect_half + (data->height - 1L) * data->width;
         frameBuffer.insert(
             echan->name,
@@ -1188,6 +1194,21 @@ void IMB_exr_write_channels(void *handle)
       }
     }
 
+    /* Convert all half channels in parallel. Multilayer render results easily reach dozens of
+     * channels, and converting them one after another leaves the file save serial ahead of the
+     * (already threaded) OpenEXR compression. */
+    blender::threading::parallel_for(
+        half_conversions.index_range(), 1, [&](const blender::IndexRange range) {
+          for (const int64_t conversion_index : range) {
+            ExrChannel *echan = half_conversions[conversion_index].first;
+            half *cur = half_conversions[conversion_index].second;
+            const float *rect = echan->rect;
+            for (size_t i = 0; i < num_pixels; i++, cur++) {
+              *cur = float_to_half_safe(rect[i * echan->xstride]);
+            }
+          }
+        });
+
     data->ofile->setFrameBuffer(frameBuffer);
     try {
       data->ofile->writePixels(data->height);
@@ -744,6 +744,17 @@ bool AbcMeshReader::topology_changed(const Mesh *existing_mesh, const ISampleSel
   return false;
 }
 
+/* NOTE: Sample reads happen here, inside depsgraph evaluation of each Mesh Sequence Cache
+ * modifier: one object at a time, on the evaluation thread, seeking and decompressing the Ogawa
+ * stream for exactly the requested frame. During playback of Alembic-heavy shots this serial
+ * read/decompress chain is the per-frame stall. The archive is shared per #CacheFile
+ * (see `abc_util.cc` / blenkernel CacheFile handling), which is the natural owner for a prefetch
+ * layer: a background pool that, on a frame change, reads the next frames' samples for all
+ * readers of the archive into a small ring keyed by (object, time), so this function becomes a
+ * lookup with a synchronous fallback. Ogawa streams support concurrent reads on independent
+ * group offsets, so per-object decompression parallelizes; eviction follows playback direction.
+ * Prefetched raw samples must be retained as Alembic sample pointers, not converted meshes --
+ * conversion touches bmain data and has to stay on the evaluation thread. */
 Mesh *AbcMeshReader::read_mesh(Mesh *existing_mesh,
                                const ISampleSelector &sample_sel,
                                const int read_flag,
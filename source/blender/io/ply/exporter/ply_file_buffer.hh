@@ -28,6 +28,15 @@ namespace blender::io::ply {
  * (list of default 64 kilobyte blocks).
  * Call write_to_file once in a while to write the memory buffer(s)
  * into the given file.
+ *
+ * \note All formatting funnels through one instance on one thread, which is the export
+ * bottleneck for scan meshes in the 100M-triangle range (the ASCII `fmt` formatting especially).
+ * Vertex and face records have no cross-record state, so the data writers in
+ * `ply_export_data.cc` could format element ranges into independent FileBuffer instances in
+ * parallel and append them to the file in range order; the OBJ exporter already formats chunks
+ * this way (see `obj_export_file_writer.cc`), and extracting its chunk scheme into a shared
+ * io_common utility would serve PLY and STL alike. Only the header and element counts are order
+ * sensitive, and they are known before any data formatting starts.
  */
 class FileBuffer : private NonMovable {
   using VectorChar = Vector<char>;
@@ -339,6 +339,17 @@ InstancerData *HydraSceneDelegate::instancer_data(pxr::SdfPath const &id, bool c
   return nullptr;
 }
 
+/* NOTE: Per-prim dirty mapping already exists — MeshData::update() translates
+ * ID_RECALC_TRANSFORM / ID_RECALC_SHADING into DirtyTransform / DirtyMaterialId without touching
+ * mesh buffers. Two things still make a plain transform tweak expensive in big scenes. First,
+ * any ID_OB update collapses into `do_update_collection`, and update_collection() walks every
+ * object in the depsgraph rebuilding the visibility set; the updated-ID iteration below already
+ * knows exactly which objects changed, so the full walk should be reserved for changes that can
+ * alter membership (visibility, collection structure — the ID_SCE cases), with per-object
+ * updates dispatched directly otherwise. Second, ID_RECALC_GEOMETRY always re-runs init() and
+ * re-uploads all submesh buffers; deform-only updates (no topology change) could write
+ * positions/normals and mark DirtyPoints | DirtyNormals, but distinguishing them needs a
+ * topology version on the evaluated mesh, which recalc flags alone do not provide. */
 void HydraSceneDelegate::check_updates()
 {
   bool do_update_collection = false;
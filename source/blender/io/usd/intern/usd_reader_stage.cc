@@ -381,6 +381,15 @@ USDPrimReader *USDStageReader::collect_readers(Main *bmain,
   return reader;
 }
 
+/* NOTE: The stage opens with all payloads loaded and every prim converts to Blender data
+ * eagerly, so set files import their full contents even when only a fraction is ever touched.
+ * USD's payload mechanism supports deferring this: open the stage with
+ * `UsdStage::OpenMasked`/`LoadNone`, create bounds-only placeholder objects for unloaded payload
+ * roots (extents come from the authored `extentsHint` without loading), and call
+ * `stage->Load(path)` followed by a conversion of just that subtree when the placeholder is made
+ * visible or expanded. The import operator is one-shot today -- the stage is dropped after
+ * conversion -- so on-demand population first needs the stage kept alive for the session, which
+ * is the same lifetime requirement the USD sequence cache already deals with. */
 void USDStageReader::collect_readers(Main *bmain)
 {
   if (!valid()) {
@@ -487,6 +487,16 @@ static void use_all_vertices_if_no_faces(Geometry *geom,
   }
 }
 
+/* NOTE: Parsing is single threaded; on multi-gigabyte photogrammetry files it is the import
+ * bottleneck even with the fast number parsing in `obj_import_string_utils`. The format allows a
+ * parallel split: partition the file at line boundaries into large chunks, parse each chunk into
+ * a per-thread #Geometry / vertex arena, then merge with index fixups. Two properties of OBJ make
+ * the merge the hard part and must not be lost: parser state (current object, group, material,
+ * smooth flag) carries across lines, so each chunk has to be sequentially scanned for state
+ * changes (cheap, no number parsing) before its data parse can run in parallel; and relative
+ * (negative) indices refer to the running global vertex count, so chunks containing them can only
+ * resolve indices after the preceding chunks' vertex counts are known. Line continuations
+ * (see #fixup_line_continuations) also mean chunk boundaries must split on unescaped newlines. */
 void OBJParser::parse(Vector<std::unique_ptr<Geometry>> &r_all_geometries,
                       GlobalVertices &r_global_vertices)
 {
@@ -196,6 +196,30 @@ typedef struct bPoseChannel_BBoneSegmentBoundary {
   float depth_scale;
 } bPoseChannel_BBoneSegmentBoundary;
 
+/**
+ * Inputs of the pose matrix calculation of a constraint-free, non-IK pose channel, cached to
+ * skip re-calculating matrices of bones whose inputs did not change since the previous
+ * evaluation. A zeroed struct (`is_valid == 0`) denotes an invalid cache; the runtime data is
+ * cleared on copy, so the cache never survives a copy-on-write update of the object.
+ */
+typedef struct bPoseChannel_MatrixCache {
+  /* Channel transform, inputs of #BKE_pchan_calc_mat. */
+  float loc[3], size[3];
+  float eul[3], quat[4];
+  float rot_axis[3], rot_angle;
+  /* Rest matrix of the bone in armature space. Cumulative over the parents, so it also captures
+   * rest-data changes of the whole chain above the bone. */
+  float arm_mat[4][4];
+  /* Pose matrix of the parent channel, identity for root channels. */
+  float parent_pose_mat[4][4];
+  /* Cyclic offset, only applied to root channels. */
+  float cyclic_offset[3];
+  int bone_flag;
+  short rotmode;
+  char is_valid;
+  char _pad[1];
+} bPoseChannel_MatrixCache;
+
 typedef struct bPoseChannel_Runtime {
   SessionUUID session_uuid;
 
@@ -220,6 +244,9 @@ typedef struct bPoseChannel_Runtime {
   /* Segment boundaries for curved mode. */
   struct bPoseChannel_BBoneSegmentBoundary *bbone_segment_boundaries;
   void *_pad;
+
+  /* Cached matrix calculation inputs of the previous evaluation. */
+  bPoseChannel_MatrixCache matrix_cache;
 } bPoseChannel_Runtime;
 
 /* ************************************************ */
@@ -608,6 +608,15 @@ typedef struct FCurve {
    */
   int active_keyframe_index;
 
+  /**
+   * Index of the keyframe segment the curve was last evaluated in, used as a search hint to
+   * speed up repeated evaluations at nearby times (scrubbing, playback, subframe sampling).
+   * Runtime data: the value is validated against the keyframes before use, so a stale or
+   * never-initialized index is harmless.
+   */
+  int last_eval_segment;
+  char _pad1[4];
+
   /* value cache + settings */
   /** Value stored from last time curve was evaluated (not threadsafe, debug display only!). */
   float curval;
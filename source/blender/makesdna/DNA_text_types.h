@@ -13,6 +13,17 @@
 #include "DNA_ID.h"
 #include "DNA_listBase.h"
 
+/**
+ * \note One heap allocation per line in a linked list makes most editor operations O(lines):
+ * `txt_get_span` and friends walk the list, and pasting or add-on logging into a large internal
+ * text re-links and re-formats per line, which is what makes 80k-line generated scripts unusable.
+ * Because this is DNA, the list is also the file format; a gap-buffer or piece-table backend
+ * would live in runtime (built on load, flattened back to lines on write) behind the `txt_*` API
+ * in `BKE_text.h`, keeping `bpy.data.texts` line semantics intact. The `format` cache below has
+ * the same scaling problem from the other side: edits re-run whole-text formatting, where
+ * re-lexing only the lines whose scanner start-state changed (tracked per line) plus the visible
+ * range bounds highlighting work by viewport height instead of file size.
+ */
 typedef struct TextLine {
   struct TextLine *next, *prev;
 
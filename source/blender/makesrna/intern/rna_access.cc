@@ -755,6 +755,17 @@ bool RNA_struct_is_a(const StructRNA *type, const StructRNA *srna)
   return false;
 }
 
+/* NOTE: For structs that exist at #RNA_init time this resolves through the per-struct
+ * `prophash` GHash (see #rna_builtin_properties_lookup_string), but every call still re-hashes
+ * the identifier string and walks the `srna->base` chain, and runtime-registered structs
+ * (Python-defined operators/panels) never get a `prophash` at all and fall back to a linear
+ * STREQ walk. For scripts that touch the same properties millions of times the wins are, in
+ * order: build `prophash` for runtime structs at registration time (definition is main-thread,
+ * so no locking concern there, unlike lazily building it inside this hot lookup); have makesrna
+ * emit static minimal-perfect-hash tables per generated StructRNA so startup skips the GHash
+ * build and lookups avoid chasing; and expose a cached-handle pattern to `bpy` so batch code
+ * resolves a #PropertyRNA once and re-uses it -- the C API already works that way, only the
+ * Python attribute path re-resolves per access. */
 PropertyRNA *RNA_struct_find_property(PointerRNA *ptr, const char *identifier)
 {
   if (identifier[0] == '[' && identifier[1] == '"') {
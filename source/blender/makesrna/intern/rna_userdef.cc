@@ -7055,6 +7055,12 @@ static void rna_def_userdef_experimental(BlenderRNA *brna)
       "These paths are exposed as add-ons, package management is not yet integrated");
   RNA_def_property_boolean_funcs(
       prop, nullptr, "rna_PreferencesExperimental_use_extension_repos_set");
+
+  prop = RNA_def_property(srna, "use_undo_compact_memory", PROP_BOOLEAN, PROP_NONE);
+  RNA_def_property_ui_text(prop,
+                           "Undo Memory Compacting",
+                           "Compress undo steps once they are no longer adjacent to the active "
+                           "one, reducing the memory used by a long undo history");
 }
 
 static void rna_def_userdef_addon_collection(BlenderRNA *brna, PropertyRNA *cprop)
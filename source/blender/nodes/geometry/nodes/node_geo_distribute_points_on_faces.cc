@@ -7,6 +7,7 @@
 #include "BLI_math_rotation.h"
 #include "BLI_math_rotation.hh"
 #include "BLI_noise.hh"
+#include "BLI_offset_indices.hh"
 #include "BLI_rand.hh"
 #include "BLI_task.hh"
 #include "BLI_timeit.hh"
@@ -116,40 +117,73 @@ static void sample_mesh_surface(const Mesh &mesh,
   const Span<int> corner_verts = mesh.corner_verts();
   const Span<int3> corner_tris = mesh.corner_tris();
 
-  for (const int tri_i : corner_tris.index_range()) {
-    const int3 &tri = corner_tris[tri_i];
-    const int v0_loop = tri[0];
-    const int v1_loop = tri[1];
-    const int v2_loop = tri[2];
-    const float3 &v0_pos = positions[corner_verts[v0_loop]];
-    const float3 &v1_pos = positions[corner_verts[v1_loop]];
-    const float3 &v2_pos = positions[corner_verts[v2_loop]];
-
-    float corner_tri_density_factor = 1.0f;
-    if (!density_factors.is_empty()) {
-      const float v0_density_factor = std::max(0.0f, density_factors[v0_loop]);
-      const float v1_density_factor = std::max(0.0f, density_factors[v1_loop]);
-      const float v2_density_factor = std::max(0.0f, density_factors[v2_loop]);
-      corner_tri_density_factor = (v0_density_factor + v1_density_factor + v2_density_factor) /
-                                  3.0f;
+  /* The amount of points on every triangle is determined in a separate pass first, so that the
+   * output arrays can be allocated at their final size right away and be filled in parallel. Both
+   * passes seed the RNG per triangle, which keeps the generated points independent of how the
+   * work is split up. */
+  Array<int> tri_offset_data(corner_tris.size() + 1);
+  threading::parallel_for(corner_tris.index_range(), 1024, [&](const IndexRange range) {
+    for (const int tri_i : range) {
+      const int3 &tri = corner_tris[tri_i];
+      const int v0_loop = tri[0];
+      const int v1_loop = tri[1];
+      const int v2_loop = tri[2];
+      const float3 &v0_pos = positions[corner_verts[v0_loop]];
+      const float3 &v1_pos = positions[corner_verts[v1_loop]];
+      const float3 &v2_pos = positions[corner_verts[v2_loop]];
+
+      float corner_tri_density_factor = 1.0f;
+      if (!density_factors.is_empty()) {
+        const float v0_density_factor = std::max(0.0f, density_factors[v0_loop]);
+        const float v1_density_factor = std::max(0.0f, density_factors[v1_loop]);
+        const float v2_density_factor = std::max(0.0f, density_factors[v2_loop]);
+        corner_tri_density_factor = (v0_density_factor + v1_density_factor + v2_density_factor) /
+                                    3.0f;
+      }
+      const float area = area_tri_v3(v0_pos, v1_pos, v2_pos);
+
+      const int corner_tri_seed = noise::hash(tri_i, seed);
+      RandomNumberGenerator corner_tri_rng(corner_tri_seed);
+
+      tri_offset_data[tri_i] = corner_tri_rng.round_probabilistic(area * base_density *
+                                                                  corner_tri_density_factor);
     }
-    const float area = area_tri_v3(v0_pos, v1_pos, v2_pos);
-
-    const int corner_tri_seed = noise::hash(tri_i, seed);
-    RandomNumberGenerator corner_tri_rng(corner_tri_seed);
-
-    const int point_amount = corner_tri_rng.round_probabilistic(area * base_density *
-                                                                corner_tri_density_factor);
-
-    for (int i = 0; i < point_amount; i++) {
-      const float3 bary_coord = corner_tri_rng.get_barycentric_coordinates();
-      float3 point_pos;
-      interp_v3_v3v3v3(point_pos, v0_pos, v1_pos, v2_pos, bary_coord);
-      r_positions.append(point_pos);
-      r_bary_coords.append(bary_coord);
-      r_tri_indices.append(tri_i);
+  });
+  const OffsetIndices<int> tri_offsets = offset_indices::accumulate_counts_to_offsets(
+      tri_offset_data);
+  const int points_num = tri_offsets.total_size();
+
+  r_positions.resize(points_num);
+  r_bary_coords.resize(points_num);
+  r_tri_indices.resize(points_num);
+
+  threading::parallel_for(corner_tris.index_range(), 1024, [&](const IndexRange range) {
+    for (const int tri_i : range) {
+      const IndexRange points_range = tri_offsets[tri_i];
+      if (points_range.is_empty()) {
+        continue;
+      }
+      const int3 &tri = corner_tris[tri_i];
+      const float3 &v0_pos = positions[corner_verts[tri[0]]];
+      const float3 &v1_pos = positions[corner_verts[tri[1]]];
+      const float3 &v2_pos = positions[corner_verts[tri[2]]];
+
+      const int corner_tri_seed = noise::hash(tri_i, seed);
+      RandomNumberGenerator corner_tri_rng(corner_tri_seed);
+      /* Skip the value that determined the amount of points in the counting pass, so that the
+       * barycentric coordinates are the same values the serial loop used to produce. */
+      corner_tri_rng.get_float();
+
+      for (const int i : points_range) {
+        const float3 bary_coord = corner_tri_rng.get_barycentric_coordinates();
+        float3 point_pos;
+        interp_v3_v3v3v3(point_pos, v0_pos, v1_pos, v2_pos, bary_coord);
+        r_positions[i] = point_pos;
+        r_bary_coords[i] = bary_coord;
+        r_tri_indices[i] = tri_i;
+      }
     }
-  }
+  });
 }
 
 BLI_NOINLINE static KDTree_3d *build_kdtree(Span<float3> positions)
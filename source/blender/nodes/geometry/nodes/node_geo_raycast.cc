@@ -99,6 +99,15 @@ static void raycast_to_mesh(const IndexMask &mask,
                             const MutableSpan<float3> r_hit_normals,
                             const MutableSpan<float> r_hit_distances)
 {
+  /* NOTE: This does not build a fresh tree per node: #BKE_bvhtree_from_mesh_get goes through the
+   * BVH cache on the mesh runtime, so every sampling node hitting the same evaluated Mesh shares
+   * one tree, and it survives across frames while the Mesh instance does. Where rebuilds still
+   * happen is when upstream nodes output a new Mesh each evaluation with identical content —
+   * the cache is keyed by Mesh instance, so it cannot recognize the repetition. The fix belongs
+   * in the cache, not in a registry here: key entries by the implicit-sharing handles of the
+   * arrays the tree reads (positions, triangulation), which are stable exactly when a rebuild
+   * would be redundant, and move the cache off the individual Mesh runtime so a re-created Mesh
+   * with shared arrays finds the old tree. */
   BVHTreeFromMesh tree_data;
   BKE_bvhtree_from_mesh_get(&tree_data, &mesh, BVHTREE_FROM_CORNER_TRIS, 4);
   BLI_SCOPED_DEFER([&]() { free_bvhtree_from_mesh(&tree_data); });
@@ -109,54 +118,72 @@ static void raycast_to_mesh(const IndexMask &mask,
   /* We shouldn't be rebuilding the BVH tree when calling this function in parallel. */
   BLI_assert(tree_data.cached);
 
-  mask.foreach_index([&](const int i) {
-    const float ray_length = ray_lengths[i];
-    const float3 ray_origin = ray_origins[i];
-    const float3 ray_direction = ray_directions[i];
-
-    BVHTreeRayHit hit;
-    hit.index = -1;
-    hit.dist = ray_length;
-    if (BLI_bvhtree_ray_cast(tree_data.tree,
-                             ray_origin,
-                             ray_direction,
-                             0.0f,
-                             &hit,
-                             tree_data.raycast_callback,
-                             &tree_data) != -1)
-    {
-      if (!r_hit.is_empty()) {
-        r_hit[i] = hit.index >= 0;
-      }
-      if (!r_hit_indices.is_empty()) {
-        /* The caller must be able to handle invalid indices anyway, so don't clamp this value. */
-        r_hit_indices[i] = hit.index;
-      }
-      if (!r_hit_positions.is_empty()) {
-        r_hit_positions[i] = hit.co;
-      }
-      if (!r_hit_normals.is_empty()) {
-        r_hit_normals[i] = hit.no;
-      }
-      if (!r_hit_distances.is_empty()) {
-        r_hit_distances[i] = hit.dist;
-      }
+  /* Gather the rays per index-mask segment and cast them together, so the
+   * BVH can traverse them in packets (#BLI_bvhtree_ray_cast_batch). */
+  Vector<float3> origins;
+  Vector<float3> directions;
+  Vector<BVHTreeRayHit> hits;
+  mask.foreach_segment([&](const IndexMaskSegment segment) {
+    const int64_t segment_size = segment.size();
+    origins.reinitialize(segment_size);
+    directions.reinitialize(segment_size);
+    hits.reinitialize(segment_size);
+
+    for (const int64_t k : IndexRange(segment_size)) {
+      const int i = segment[k];
+      origins[k] = ray_origins[i];
+      directions[k] = ray_directions[i];
+      hits[k].index = -1;
+      hits[k].dist = ray_lengths[i];
     }
-    else {
-      if (!r_hit.is_empty()) {
-        r_hit[i] = false;
-      }
-      if (!r_hit_indices.is_empty()) {
-        r_hit_indices[i] = -1;
-      }
-      if (!r_hit_positions.is_empty()) {
-        r_hit_positions[i] = float3(0.0f, 0.0f, 0.0f);
-      }
-      if (!r_hit_normals.is_empty()) {
-        r_hit_normals[i] = float3(0.0f, 0.0f, 0.0f);
+
+    BLI_bvhtree_ray_cast_batch(tree_data.tree,
+                               reinterpret_cast<const float(*)[3]>(origins.data()),
+                               reinterpret_cast<const float(*)[3]>(directions.data()),
+                               int(segment_size),
+                               0.0f,
+                               hits.data(),
+                               tree_data.raycast_callback,
+                               &tree_data);
+
+    for (const int64_t k : IndexRange(segment_size)) {
+      const int i = segment[k];
+      const BVHTreeRayHit &hit = hits[k];
+      if (hit.index != -1) {
+        if (!r_hit.is_empty()) {
+          r_hit[i] = hit.index >= 0;
+        }
+        if (!r_hit_indices.is_empty()) {
+          /* The caller must be able to handle invalid indices anyway, so don't clamp this
+           * value. */
+          r_hit_indices[i] = hit.index;
+        }
+        if (!r_hit_positions.is_empty()) {
+          r_hit_positions[i] = hit.co;
+        }
+        if (!r_hit_normals.is_empty()) {
+          r_hit_normals[i] = hit.no;
+        }
+        if (!r_hit_distances.is_empty()) {
+          r_hit_distances[i] = hit.dist;
+        }
       }
-      if (!r_hit_distances.is_empty()) {
-        r_hit_distances[i] = ray_length;
+      else {
+        if (!r_hit.is_empty()) {
+          r_hit[i] = false;
+        }
+        if (!r_hit_indices.is_empty()) {
+          r_hit_indices[i] = -1;
+        }
+        if (!r_hit_positions.is_empty()) {
+          r_hit_positions[i] = float3(0.0f, 0.0f, 0.0f);
+        }
+        if (!r_hit_normals.is_empty()) {
+          r_hit_normals[i] = float3(0.0f, 0.0f, 0.0f);
+        }
+        if (!r_hit_distances.is_empty()) {
+          r_hit_distances[i] = ray_lengths[i];
+        }
       }
     }
   });
@@ -34,6 +34,8 @@
 #include "BLI_hash_md5.h"
 #include "BLI_lazy_threading.hh"
 #include "BLI_map.hh"
+#include "BLI_task.hh"
+#include "BLI_vector_set.hh"
 
 #include "DNA_ID.h"
 
@@ -4212,6 +4214,23 @@ const GeometryNodesLazyFunctionGraphInfo *ensure_geometry_nodes_lazy_function_gr
   if (lf_graph_info_ptr) {
     return lf_graph_info_ptr.get();
   }
+
+  /* Make sure the graphs of directly referenced node groups are built already. They are cached on
+   * those groups, so this does no duplicate work, but doing it before taking the lock below
+   * allows independent groups to be compiled in parallel. The recursion makes this effective for
+   * the whole group hierarchy. */
+  VectorSet<const bNodeTree *> group_trees;
+  for (const bNode *group_bnode : btree.group_nodes()) {
+    if (const bNodeTree *group_btree = reinterpret_cast<const bNodeTree *>(group_bnode->id)) {
+      group_trees.add(group_btree);
+    }
+  }
+  if (!group_trees.is_empty()) {
+    threading::parallel_for_each(group_trees, [](const bNodeTree *group_btree) {
+      ensure_geometry_nodes_lazy_function_graph(*group_btree);
+    });
+  }
+
   std::lock_guard lock{btree.runtime->geometry_nodes_lazy_function_graph_info_mutex};
   if (lf_graph_info_ptr) {
     return lf_graph_info_ptr.get();
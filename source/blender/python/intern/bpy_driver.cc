@@ -570,6 +570,18 @@ bool BPY_driver_secure_bytecode_test(PyObject *expr_code,
 }
 
 #endif /* USE_BYTECODE_WHITELIST */
+/* NOTE: Two of the usual suspects for Python driver cost are already handled: expressions that
+ * the simple evaluator covers never reach this function (BLI_expr_pylike in fcurve_driver.cc
+ * handles comparisons, ternary conditionals and the math-module functions), and compiled code
+ * objects are cached on the original driver (`expr_comp` below), so there is no per-frame
+ * compile. The remaining per-driver overhead is PyGILState_Ensure()/Release() plus rebuilding the
+ * variables dict each call. Batching all Python drivers into one GIL scope per frame cannot be
+ * done from inside this function — drivers are independent depsgraph nodes and arrive here from
+ * arbitrary evaluation threads. It needs scheduler cooperation: tag Python-dependent driver
+ * nodes, have the depsgraph run them as one serial group (they serialize on the GIL anyway, so
+ * no parallelism is lost), and let that group hold a single GIL ensure. The dict rebuild is the
+ * independently fixable part: cache `driver_vars` keyed on the variable name set and only update
+ * the values. */
 float BPY_driver_exec(PathResolvedRNA *anim_rna,
                       ChannelDriver *driver,
                       ChannelDriver *driver_orig,
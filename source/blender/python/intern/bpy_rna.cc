@@ -5424,6 +5424,17 @@ static bool foreach_compat_buffer(RawPropertyType raw_type, int attr_signed, con
   return false;
 }
 
+/* NOTE: The fast path below only triggers when the destination buffer's item type exactly
+ * matches the property's #RawPropertyType and the property supports raw access
+ * (`RNA_property_collection_raw_get/set`); anything else -- enums, booleans stored as bit-flags,
+ * type-converting copies like float buffer over double property, and any property without a
+ * raw-array DNA backing -- degrades to one Python call per item, which is the 20MB/s path
+ * pipelines hit when bulk-exporting attributes. Closing that gap is mostly RNA-side work, not
+ * here: the raw-access layer needs typed stride-copy with conversion (so a dtype mismatch means
+ * a converting memcpy loop instead of the Python fallback) and raw definitions for the enum/bool
+ * properties that are plain ints/chars in DNA. Mesh attribute layers are better served by the
+ * `attributes` API which exposes typed arrays directly; bmesh has no raw layer at all and needs
+ * its own batch accessors. */
 static PyObject *foreach_getset(BPy_PropertyRNA *self, PyObject *args, int set)
 {
   PyObject *item = nullptr;
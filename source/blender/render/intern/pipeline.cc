@@ -2216,6 +2216,18 @@ static void re_movie_free_all(Render *re, bMovieHandle *mh, int totvideos)
   MEM_SAFE_FREE(re->movie_ctx_arr);
 }
 
+/* NOTE: The frame loop below is strictly serial: scene frame-set and depsgraph update, engine
+ * render, compositor, then file write all complete before the next frame starts, so the engine
+ * idles during evaluation and I/O and vice versa. Pipelining is possible because the stages have
+ * disjoint state: frame N+1's depsgraph update could run on a second evaluated copy while frame
+ * N renders, and frame N-1's compositing/write only needs its own RenderResult, which is already
+ * implicit-sharing backed and safe to hand to a writer thread. The constraints that shape the
+ * design: the engine session assumes one scene state at a time, so pre-evaluation needs a second
+ * depsgraph and a delta hand-over rather than mutating `re->pipeline_depsgraph`; movie writing
+ * must stay in frame order (a bounded reorder queue at `mh->append_movie`); and in-flight frames
+ * hold full result memory, so the depth must be capped by a byte budget, not a frame count.
+ * Python frame-change handlers observe frames in order either way since evaluation stays serial
+ * with itself. */
 void RE_RenderAnim(Render *re,
                    Main *bmain,
                    Scene *scene,
@@ -23,6 +23,16 @@ enum {
   DO_CLOCK_WIPE,
 };
 
+/* NOTE: All effects are CPU `ImBuf` math. A GPU strip-render backend would keep decoded frames
+ * resident as #GPUTexture for the whole stack and only read back the final composite, which is
+ * where the win is -- per-effect upload/download would cost more than the shader saves. The
+ * transform, blend and color operations map directly onto the shader library the realtime
+ * compositor already ships (`source/blender/compositor/realtime_compositor`); the natural shape
+ * is an optional `execute_gpu` alongside `execute` below, with the renderer falling back to the
+ * CPU path whenever any effect in the stack lacks it or no GPU context is available (background
+ * renders, `--factory-startup` tests). Prefetch threads complicate this: sequencer rendering runs
+ * off the main thread, so GPU execution has to go through the draw manager's deferred context
+ * like viewport offscreen rendering does. */
 struct SeqEffectHandle {
   bool multithreaded;
   bool supports_mask;
@@ -176,6 +176,19 @@ static bool seq_prefetch_is_cache_full(Scene *scene)
   return seq_cache_recycle_item(pfjob->scene) == false;
 }
 
+/* NOTE: Prefetch is strictly forward: the job renders `cfra + num_frames_prefetched` and the
+ * rebase in #seq_prefetch_update_area throws all progress away as soon as the playhead moves
+ * backwards, so reverse playback and shuttle scrubbing never hit this cache. A direction-aware
+ * scheduler would track playhead velocity over the last few frame changes and issue frames from
+ * both sides of the playhead with distance-weighted priority, biased along the current scrub
+ * direction. That only pays off if eviction cooperates: `seq_cache_choose_key` in
+ * `image_cache.cc` only shields the forward prefetch range reported by
+ * #seq_prefetch_get_time_range and otherwise recycles the frame furthest from the playhead in
+ * either direction, so frames prefetched behind the playhead would be recycled straight away
+ * unless the shielded range and the distance weighting share the direction estimate. The single
+ * advancing
+ * `num_frames_prefetched` counter would become a frame set/queue, which also removes the
+ * full-reset cost of a backwards jump. */
 static float seq_prefetch_cfra(PrefetchJob *pfjob)
 {
   return pfjob->cfra + pfjob->num_frames_prefetched;
@@ -510,6 +510,15 @@ bool SEQ_proxy_rebuild_context(Main *bmain,
   return true;
 }
 
+/* NOTE: Proxy building is one frame at a time: each iteration decodes, scales, color-transforms
+ * and encodes before the next frame starts, so the decoder, the scaler and the encoder each idle
+ * while the others work. The stages have no cross-frame dependencies (movie-strip indexing in
+ * `IMB_anim_index_rebuild` excepted, since encoders must consume frames in order), so the loop is
+ * a natural pipeline: decode, scale + color transform, and encode on separate workers connected
+ * by small bounded queues, with frame memory recycled through a pool to keep the working set
+ * fixed. Cancellation and the progress report (currently per-iteration below) would move to the
+ * slowest stage. Ordered encoding means the encode stage must reassemble frame order if the
+ * middle stage runs with more than one worker. */
 void SEQ_proxy_rebuild(SeqIndexBuildContext *context, wmJobWorkerStatus *worker_status)
 {
   const bool overwrite = context->overwrite;
@@ -25,6 +25,7 @@
 #include "BLI_math_rotation.h"
 #include "BLI_math_vector_types.hh"
 #include "BLI_path_util.h"
+#include "BLI_profile.hh"
 #include "BLI_rect.h"
 
 #include "BKE_anim_data.h"
@@ -1779,6 +1780,7 @@ ImBuf *seq_render_strip(const SeqRenderData *context,
                         Sequence *seq,
                         float timeline_frame)
 {
+  BLI_PROFILE_SCOPE("Strip Render", "sequencer");
   ImBuf *ibuf = nullptr;
   bool use_preprocess = false;
   bool is_proxy_image = false;
@@ -1877,6 +1879,16 @@ static ImBuf *seq_render_strip_stack_apply_effect(
   return out;
 }
 
+/* NOTE: Effects in the stack run strictly one after another: each one is internally
+ * line-parallel (#seq_render_effect_execute_threaded splits the output into bands over
+ * `execute_slice`), but all threads join between effects, and with many cores the join overhead
+ * plus the full-frame intermediate buffers dominate. Since `execute_slice` already only reads the
+ * input rows of its own band for every blend mode, the stack could instead pipeline: push each
+ * horizontal band through the entire effect chain on one thread, so a band-sized working set stays
+ * in cache and threads never synchronize until final assembly. That requires per-band intermediate
+ * allocation, moving the early-out and cache decisions (which are per-frame) out of the band loop,
+ * and excluding effects without `execute_slice` or with non-local reads (transform, blur),
+ * which must act as full-frame barriers between pipelined segments. */
 static ImBuf *seq_render_strip_stack(const SeqRenderData *context,
                                      SeqRenderState *state,
                                      ListBase *channels,
@@ -584,6 +584,17 @@ DO_INLINE void initdiag_bfmatrix(fmatrix3x3 *matrix, float m3[3][3])
 
 /* SPARSE SYMMETRIC multiply big matrix with long vector. */
 /* STATUS: verified */
+/* NOTE: This SpMV and #dot_lfvector dominate the PCG solve, yet between the two OpenMP sections
+ * here and the disabled reduction in the dot product, the solver effectively uses two cores. The
+ * row-major triplet layout is the obstacle: scattered `to[r] += m * x[c]` updates race between
+ * threads, which is why the parallelism stops at two sections. A modernized core behind the same
+ * #SIM_cloth_solve interface would convert the assembled triplets once per step to block-CSR
+ * (3x3 blocks, rows sorted), making SpMV a race-free parallel-for over row ranges via BLI_task
+ * with SIMD 3x3 block kernels, and give dot products a deterministic fixed-split reduction --
+ * the commutativity concern that keeps the OpenMP reduction disabled above goes away when the
+ * partial-sum partition is fixed rather than schedule-dependent. Assembly
+ * (`SIM_mass_spring_force_*`) stays on the triplet structure, so only the solve-side kernels
+ * change. */
 DO_INLINE void mul_bfmatrix_lfvector(float (*to)[3], fmatrix3x3 *from, lfVector *fLongVector)
 {
   uint vcount = from[0].vcount;
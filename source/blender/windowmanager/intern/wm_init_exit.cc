@@ -196,6 +196,23 @@ static void sound_jack_sync_callback(Main *bmain, int mode, double time)
   }
 }
 
+/* NOTE: Everything below registers eagerly, including in background mode, and dominates the
+ * pre-work latency of `blender -b` farm launches. Care is needed about what can actually be
+ * deferred: operator and space-type registration cannot simply be skipped in background mode,
+ * because scripts call `bpy.ops` from any editor's operator list and add-ons register keymaps
+ * against existing types headlessly. The deferrals that are safe by construction:
+ *
+ * - RNA structs generated by makesrna are static data; the per-struct work in #RNA_init
+ *   (identifier hashing and property map construction) can move to first lookup of each struct
+ *   with no observable difference, since nothing enumerates a struct's internals before looking
+ *   it up.
+ * - Gizmo group types and tool registration are only reachable from a window; those are pure
+ *   UI and can be guarded by `G.background` once their poll paths stop assuming presence.
+ * - Icon/preview and BLF init below already run reduced in background but still touch disk;
+ *   the remaining cost there is the datafiles read, which can be demand-loaded.
+ *
+ * Measure before moving anything else: most of the remaining startup time in background mode is
+ * Python's own interpreter and add-on init, not C-side registration. */
 void WM_init(bContext *C, int argc, const char **argv)
 {
 
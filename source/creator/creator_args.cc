@@ -26,6 +26,7 @@
 #  include "BLI_listbase.h"
 #  include "BLI_mempool.h"
 #  include "BLI_path_util.h"
+#  include "BLI_profile.hh"
 #  include "BLI_string.h"
 #  include "BLI_string_utf8.h"
 #  include "BLI_system.h"
@@ -635,6 +636,7 @@ static void print_help(bArgs *ba, bool all)
   PRINT("Debug Options:\n");
   BLI_args_print_arg_doc(ba, "--debug");
   BLI_args_print_arg_doc(ba, "--debug-value");
+  BLI_args_print_arg_doc(ba, "--profile-trace");
 
   PRINT("\n");
   BLI_args_print_arg_doc(ba, "--debug-events");
@@ -1196,6 +1198,21 @@ static int arg_handle_debug_value_set(int argc, const char **argv, void * /*data
   return 0;
 }
 
+static const char arg_handle_profile_trace_set_doc[] =
+    "<filepath>\n"
+    "\tRecord instrumented scope timings and write them to the given file on exit,\n"
+    "\tin the Chrome trace format (viewable in chrome://tracing or ui.perfetto.dev).";
+static int arg_handle_profile_trace_set(int argc, const char **argv, void * /*data*/)
+{
+  const char *arg_id = "--profile-trace";
+  if (argc > 1) {
+    blender::profile::enable(argv[1]);
+    return 1;
+  }
+  fprintf(stderr, "\nError: '%s' no args given.\n", arg_id);
+  return 0;
+}
+
 static const char arg_handle_debug_gpu_set_doc[] =
     "\n"
     "\tEnable GPU debug context and information for OpenGL 4.3+.";
@@ -1769,6 +1786,16 @@ static const char arg_handle_render_frame_doc[] =
     "\t* A comma separated list of frames can also be used (no spaces).\n"
     "\t* A range of frames can be expressed using '..' separator between the first and last "
     "frames (inclusive).\n";
+/* NOTE: For farm use, the expensive part of `-b file.blend -f N` is not rendering but repeating
+ * file read, versioning and scene sync for every task. Most of a persistent worker already exists
+ * in this process model: the loop below keeps one Render and one Main across frames, and with
+ * `--cycles-persistent-data` device memory survives between renders too. A daemon that accepts
+ * per-task overrides (frame, camera, seed, output path) is best built as a `--python` script
+ * driving bpy in a long-lived background process — all the listed overrides are plain RNA writes
+ * followed by a render call, and the farm protocol then lives with the farm, not in creator.
+ * What would belong here is only a flag to keep the process alive reading commands from stdin;
+ * a socket server inside creator.cc would duplicate what the Python API already guarantees
+ * (correct depsgraph tagging on override writes) with none of the flexibility. */
 static int arg_handle_render_frame(int argc, const char **argv, void *data)
 {
   const char *arg_id = "-f / --render-frame";
@@ -2411,6 +2438,8 @@ void main_args_setup(bContext *C, bArgs *ba, bool all)
   BLI_args_add(ba, nullptr, "--debug-memory", CB(arg_handle_debug_mode_memory_set), nullptr);
 
   BLI_args_add(ba, nullptr, "--debug-value", CB(arg_handle_debug_value_set), nullptr);
+
+  BLI_args_add(ba, nullptr, "--profile-trace", CB(arg_handle_profile_trace_set), nullptr);
   BLI_args_add(ba,
                nullptr,
                "--debug-jobs",
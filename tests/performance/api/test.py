@@ -7,6 +7,18 @@ import fnmatch
 from typing import Dict, List
 
 
+# NOTE: All current tests run blender in background mode and time whole operations (renders,
+# file loads, animation playback), which misses the interactive regressions we actually hit:
+# draw-cache rebuilds, selection/transform latency, sculpt stroke throughput. Covering those
+# needs an interaction-replay test category: tests that launch a windowed blender, feed a
+# recorded event trace through `WM_event_add_simulate` (the mechanism `--enable-event-simulate`
+# already exposes to scripts), and report per-subsystem timings instead of one wall-clock
+# number. The per-subsystem split is the missing prerequisite on the C side -- depsgraph, draw
+# extraction and render-submit times need to be queryable from Python (or dumped as JSON at
+# exit) before a replay test can attribute a regression; until then a new Test subclass can
+# only report end-to-end frame times. Trace .blend files belong in the benchmark files repo
+# next to the existing scenes, with the event trace embedded as a text datablock so the file
+# stays self-contained.
 class Test:
     @abc.abstractmethod
     def name(self) -> str: